@@ -5,10 +5,17 @@
  */
 
 #pragma once
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -17,7 +24,16 @@
 #include "tt_silicon_driver_common.hpp"
 #include "tt_soc_descriptor.h"
 #include "tt_xy_pair.h"
+#include "umd/device/core_set.h"
+#include "umd/device/driver_trace.h"
+#include "umd/device/host_memory_registration_cache.h"
+#include "umd/device/lock_stats.h"
 #include "umd/device/pci_device.hpp"
+#include "umd/device/phase_profiler.h"
+#include "umd/device/remote_transfer_engine.h"
+#include "umd/device/session_record.h"
+#include "umd/device/span.h"
+#include "umd/device/transfer_profile.h"
 #include "umd/device/tlb.h"
 #include "umd/device/tt_cluster_descriptor_types.h"
 #include "umd/device/tt_io.hpp"
@@ -29,10 +45,6 @@ using TLB_DATA = tt::umd::tlb_data;
 tt::ARCH detect_arch(int pci_device_num);
 tt::ARCH detect_arch();
 
-namespace boost::interprocess {
-class named_mutex;
-}
-
 class tt_ClusterDescriptor;
 
 enum tt_DevicePowerState { BUSY, SHORT_IDLE, LONG_IDLE };
@@ -142,6 +154,9 @@ struct tt_device_params {
     std::vector<std::string> vcd_dump_cores;
     std::vector<std::string> plusargs;
     bool init_device = true;
+    // Skip the device initialization steps which are still in effect from the previous process, see
+    // Cluster::start_device.
+    bool resume_session = false;
     bool early_open_device = false;
     int aiclk = 0;
 
@@ -220,6 +235,16 @@ struct tt_device_params {
     }
 };
 
+/**
+ * One write of a scatter_write_to_cluster call. The data has to stay valid until the call returns.
+ */
+struct tt_scatter_write {
+    const void* mem_ptr = nullptr;
+    std::uint64_t size_in_bytes = 0;
+    tt_cxy_pair core = {};
+    std::uint64_t address = 0;
+};
+
 // TODO: This class is to be removed once we move Simulation and Mockup devices to be Chips instead of Clusters.
 /**
  * Parent class for Cluster (Silicon Driver).
@@ -383,6 +408,7 @@ public:
     /**
      * Non-MMIO (ethernet) barrier.
      * This function should be called for a remote chip. If called for local chip, it will be a no-op.
+     * Only waits for the writes to this chip, on the ethernet cores which carried them.
      */
     virtual void wait_for_non_mmio_flush(const chip_id_t chip_id) {
         throw std::runtime_error("---- tt_device::wait_for_non_mmio_flush is not implemented\n");
@@ -448,7 +474,7 @@ public:
     }
 
     virtual void l1_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {}) {
+        const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {}) {
         throw std::runtime_error("---- tt_device::l1_membar is not implemented\n");
     }
 
@@ -458,7 +484,7 @@ public:
     }
 
     virtual void dram_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {}) {
+        const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {}) {
         throw std::runtime_error("---- tt_device::dram_membar is not implemented\n");
     }
 
@@ -723,21 +749,121 @@ public:
         uint64_t address,
         uint64_t ordering = TLB_DATA::Posted);
     virtual void set_fallback_tlb_ordering_mode(const std::string& fallback_tlb, uint64_t ordering = TLB_DATA::Posted);
+    /**
+     * Stripe large transfers through dynamic TLBs across both NOCs. Chunks of the transfer alternate between the
+     * fallback TLB routed over NOC0 and noc1_tlb routed over NOC1. Writes are completed with a single read-back
+     * through the NOC1 window. Transfers smaller than min_transfer_size, and transfers using noc1_tlb as their
+     * fallback TLB, are not striped. Striping is disabled by default.
+     *
+     * @param noc1_tlb Dynamic TLB used for the NOC1 half of the transfer.
+     * @param chunk_size Number of bytes sent over one NOC before switching to the other one.
+     * @param min_transfer_size Smallest transfer that gets striped.
+     */
+    void enable_dual_noc_striping(
+        const std::string& noc1_tlb, uint32_t chunk_size = 64 * 1024, uint32_t min_transfer_size = 1024 * 1024);
+    void disable_dual_noc_striping();
+    /**
+     * Balance large transfers to remote chips across MMIO chips. A transfer of at least min_transfer_size bytes can go
+     * through any MMIO chip within max_extra_hops ethernet hops of the closest one, and picks the one with the fewest
+     * commands queued on its ethernet core. Transfers to a remote chip only move to another MMIO chip once the ones
+     * which picked the previous one are queued, and its queues have been flushed, so they stay in order. Disabled by
+     * default, in which case transfers always go through the closest MMIO chip.
+     *
+     * @param max_extra_hops Extra ethernet hops allowed compared to the closest MMIO chip.
+     * @param min_transfer_size Smallest transfer for which the MMIO chip can be changed.
+     */
+    void enable_remote_transfer_load_balancing(uint32_t max_extra_hops = 1, uint32_t min_transfer_size = 64 * 1024);
+    void disable_remote_transfer_load_balancing();
+    /**
+     * Transfer settings in use, see TransferProfile. The cluster is constructed with the profile stored for this host
+     * in TransferProfile::get_default_path, if there is one, and with the default settings otherwise.
+     */
+    const TransferProfile& get_transfer_profile() const;
+    void set_transfer_profile(const TransferProfile& profile);
+    /**
+     * Measure the transfer settings which suit this host best. Transfers of up to TRANSFER_CALIBRATION_SIZE bytes to
+     * address on the first worker core of the first MMIO chip, and of the first remote chip if there is one, are
+     * timed, overwriting what was there. The settings in use are restored afterwards: the returned profile is neither
+     * applied nor saved, see set_transfer_profile and TransferProfile::save. Other transfers must not run meanwhile.
+     *
+     * @param address 32-byte aligned L1 address with TRANSFER_CALIBRATION_SIZE bytes free on the cores.
+     * @param fallback_tlb Dynamic TLB used for the transfers.
+     */
+    TransferProfile calibrate_transfers(std::uint64_t address, const std::string& fallback_tlb = "LARGE_WRITE_TLB");
+    static constexpr std::uint32_t TRANSFER_CALIBRATION_SIZE = 64 * 1024;
     virtual void setup_core_to_tlb_map(
         const chip_id_t logical_device_id, std::function<std::int32_t(tt_xy_pair)> mapping_function);
     virtual void configure_active_ethernet_cores_for_mmio_device(
         chip_id_t mmio_chip, const std::unordered_set<tt_xy_pair>& active_eth_cores_per_chip);
+    /**
+     * Initialize the devices for use, if device_params.init_device is set.
+     * With device_params.resume_session, a process can take over the devices from the previous one without
+     * initializing them again: when the previous process configured them with the same parameters and hugepages, and
+     * left them through close_device, the iATUs, memory barrier flags, ethernet queues and RISC resets it set up are
+     * kept, and only the power state is raised again. The memory barrier flags are read back first, so a device reset
+     * in between falls back to a full initialization. Other processes using the devices also force a full one, as do
+     * remote chips, and host memory registered by the previous process, see register_host_memory.
+     */
     virtual void start_device(const tt_device_params& device_params);
+    // Whether start_device resumed the session of the previous process instead of initializing the devices.
+    bool is_session_resumed() const;
+    /**
+     * Wall clock time spent in the phases of constructing the cluster and of start_device. A summary is logged at debug
+     * level after each of them, or at info level if the TT_UMD_PROFILE_STARTUP environment variable is set.
+     */
+    const std::vector<PhaseTiming>& get_startup_phases() const;
+    /**
+     * Record transfers, TLB reprogramming, mutex waits, ethernet queue full stalls, membars and ARC messages of all
+     * threads in the process to trace_file_path, as Chrome trace JSON. Tracing is also enabled for the lifetime of the
+     * cluster if the TT_UMD_TRACE_FILE environment variable is set. See DriverTrace.
+     */
+    void enable_tracing(const std::string& trace_file_path);
+    void disable_tracing();
+    /**
+     * Wait and hold times, and current holders, of the interprocess mutexes of an MMIO chip, summed over all processes
+     * using them. The stats are kept in shared memory until the next process opening the device with
+     * clean_system_resources, and can also be read without a Cluster through read_lock_stats.
+     */
+    std::vector<LockStats> get_lock_stats(chip_id_t mmio_chip);
+    void reset_lock_stats(chip_id_t mmio_chip);
     virtual void assert_risc_reset();
     virtual void deassert_risc_reset();
     virtual void deassert_risc_reset_at_core(
         tt_cxy_pair core, const TensixSoftResetOptions& soft_resets = TENSIX_DEASSERT_SOFT_RESET);
     virtual void assert_risc_reset_at_core(tt_cxy_pair core);
+    /**
+     * Send a soft deassert reset signal to a set of tensix or ethernet cores on a single chip.
+     * On Grayskull MMIO chips rectangles of tensix cores are reset with a single multicast write each.
+     *
+     * @param chip Chip being targeted.
+     * @param cores Cores being targeted.
+     */
+    void deassert_risc_reset_at_cores(
+        const chip_id_t chip,
+        const CoreSet& cores,
+        const TensixSoftResetOptions& soft_resets = TENSIX_DEASSERT_SOFT_RESET);
+    /**
+     * Send a soft assert reset signal to a set of tensix or ethernet cores on a single chip.
+     *
+     * @param chip Chip being targeted.
+     * @param cores Cores being targeted.
+     */
+    void assert_risc_reset_at_cores(const chip_id_t chip, const CoreSet& cores);
     virtual void close_device();
 
     // Runtime Functions
     virtual void write_to_device(
         const void* mem_ptr, uint32_t size_in_bytes, tt_cxy_pair core, uint64_t addr, const std::string& tlb_to_use);
+    /**
+     * Write a buffer of any size, including ones of several GB, to a core. The transfer is split internally, across
+     * as few TLB windows as possible on MMIO chips and across ethernet routing blocks on remote chips.
+     *
+     * @param data Source data.
+     * @param core Chip and core being targeted.
+     * @param addr Address to write to.
+     * @param tlb_to_use Specifies fallback/dynamic TLB to use.
+     */
+    void write_to_device(Span<const std::uint8_t> data, tt_cxy_pair core, uint64_t addr, const std::string& tlb_to_use);
     void broadcast_write_to_cluster(
         const void* mem_ptr,
         uint32_t size_in_bytes,
@@ -746,24 +872,190 @@ public:
         std::set<uint32_t>& rows_to_exclude,
         std::set<uint32_t>& columns_to_exclude,
         const std::string& fallback_tlb);
+    /**
+     * Broadcast a write to the same set of cores on every chip that is not excluded.
+     * A set holding exactly the cores at the crossings of some rows and columns, such as the whole worker grid, is
+     * written with a single row/column masked broadcast. Other sets are decomposed into rectangles, each of which is
+     * written with a broadcast of its own. The restrictions of the row/column broadcast_write_to_cluster apply to every
+     * broadcast.
+     *
+     * @param cores Cores being targeted on each chip.
+     */
+    void broadcast_write_to_cluster(
+        const void* mem_ptr,
+        uint32_t size_in_bytes,
+        uint64_t address,
+        const std::set<chip_id_t>& chips_to_exclude,
+        const CoreSet& cores,
+        const std::string& fallback_tlb);
+    // Largest host buffer used by broadcast_fill_cluster.
+    static constexpr std::uint32_t FILL_CHUNK_SIZE = 1 << 20;
+    /**
+     * Fill a range on a set of cores of every chip that is not excluded with a repeated pattern, for example to clear
+     * L1 or DRAM. The range is written with broadcast writes as in broadcast_write_to_cluster, from a host buffer of at
+     * most FILL_CHUNK_SIZE bytes, regardless of the size of the range.
+     *
+     * @param pattern Pattern repeated over the range, starting at address.
+     * @param pattern_size Size of the pattern, at most FILL_CHUNK_SIZE bytes.
+     * @param size_in_bytes Size of the range, which does not have to be a multiple of pattern_size.
+     * @param cores Cores being targeted on each chip.
+     */
+    void broadcast_fill_cluster(
+        const void* pattern,
+        uint32_t pattern_size,
+        uint64_t size_in_bytes,
+        uint64_t address,
+        const std::set<chip_id_t>& chips_to_exclude,
+        const CoreSet& cores,
+        const std::string& fallback_tlb);
+    /**
+     * Fill a range of DRAM channels of every chip that is not excluded with a repeated pattern. Same as the core set
+     * broadcast_fill_cluster, targeting the first core of each channel, or of every channel if channels is empty.
+     */
+    void broadcast_fill_cluster(
+        const void* pattern,
+        uint32_t pattern_size,
+        uint64_t size_in_bytes,
+        uint64_t address,
+        const std::set<chip_id_t>& chips_to_exclude,
+        const std::unordered_set<uint32_t>& channels,
+        const std::string& fallback_tlb);
+
+    /**
+     * Write a separate payload to each of a list of chip and core targets, such as the shards of a tensor. Writes are
+     * grouped by the MMIO chip they go through, and the groups are issued concurrently, so every PCIe link and every
+     * ethernet gateway is kept busy. Writes to the same chip are issued in order. Returns once all writes, including
+     * the ones to remote chips, have landed.
+     */
+    void scatter_write_to_cluster(const std::vector<tt_scatter_write>& writes, const std::string& fallback_tlb);
+
+    /**
+     * Write to a core without ordering guarantees between the individual NOC transactions. On MMIO capable chips the
+     * fallback TLB is programmed with posted ordering for this write, regardless of its configured ordering mode.
+     * The data is only guaranteed to have landed after a subsequent posted_write_barrier for the chip.
+     * Remote chips are written the same way as through write_to_device.
+     */
+    void write_to_device_posted(
+        const void* mem_ptr, uint64_t size_in_bytes, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb);
+    /**
+     * Wait until all writes issued to the chip through write_to_device_posted have completed. Every core written
+     * since the previous barrier is read back once through a strict ordering TLB.
+     */
+    void posted_write_barrier(const chip_id_t chip);
 
     virtual void read_from_device(
         void* mem_ptr, tt_cxy_pair core, uint64_t addr, uint32_t size, const std::string& fallback_tlb);
+    /**
+     * Read a buffer of any size from a core, split internally as in the span based write_to_device.
+     *
+     * @param data Buffer to read the data into, whose size is the number of bytes read.
+     */
+    void read_from_device(Span<std::uint8_t> data, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb);
+    /**
+     * Write a list of host buffers, such as the pages or shards of a tensor, to one contiguous range of a core, as if
+     * they were concatenated. Each buffer goes straight through the TLB windows on MMIO chips, or into the ethernet
+     * routing buffers on remote chips, without being concatenated into a temporary buffer first.
+     *
+     * @param segments Source buffers, written at addr one after the other.
+     * @param core Chip and core being targeted.
+     * @param addr Address to write to.
+     * @param tlb_to_use Specifies fallback/dynamic TLB to use, other than REG_TLB.
+     */
+    void write_segments_to_device(
+        const std::vector<Span<const std::uint8_t>>& segments,
+        tt_cxy_pair core,
+        uint64_t addr,
+        const std::string& tlb_to_use);
+    /**
+     * Read one contiguous range of a core into a list of host buffers, the first bytes of the range filling the first
+     * buffer. The mirror of write_segments_to_device.
+     */
+    void read_segments_from_device(
+        const std::vector<Span<std::uint8_t>>& segments,
+        tt_cxy_pair core,
+        uint64_t addr,
+        const std::string& fallback_tlb);
+    /**
+     * Read the same address range from a set of cores on each of a set of chips into one contiguous buffer. The buffer
+     * holds size_in_bytes per core, ordered by chip id and then by the NOC order of the cores, and must be large
+     * enough for chips.size() * cores.size() * size_in_bytes bytes.
+     * Chips are grouped by the MMIO chip they are accessed through, and the groups are read concurrently, so MMIO
+     * chips use their own TLBs in parallel and remote chips are read through all of their gateways at once.
+     */
+    void gather_read_from_cluster(
+        void* mem_ptr,
+        const std::set<chip_id_t>& chips,
+        const CoreSet& cores,
+        uint64_t address,
+        uint32_t size_in_bytes,
+        const std::string& fallback_tlb);
+    /**
+     * Read from a remote chip straight into host memory, without copying the data out of the ethernet routing buffers.
+     * The data lands at sysmem_offset in host channel 0 of the MMIO chip serving the remote chip. The region must not
+     * overlap the ethernet routing buffers.
+     *
+     * @param core Remote core to read from.
+     * @param addr 32 byte aligned address to read from.
+     * @param size Number of bytes to read, a multiple of 4.
+     * @param sysmem_offset 32 byte aligned offset in host channel 0 at which the data lands.
+     * @return Pointer to the data in host memory.
+     */
+    void* read_from_remote_device_to_sysmem(tt_cxy_pair core, uint64_t addr, uint32_t size, uint64_t sysmem_offset);
+    /**
+     * Make host memory addressable by an MMIO chip, so that device transfers can use it without staging it in the
+     * hugepage channels. The memory is pinned and mapped at the start of one of the 1GB host memory windows of the chip
+     * not used by hugepage channels, which needs hugepage channel 0 to be set up. The device reaches the whole iATU
+     * region mapping the memory, so registrations have to cover it: the smallest region is 128MB in window 1 and
+     * 256MB in windows 2 and 3, and a window needs at least the region of its earlier registrations. Smaller buffers
+     * can be allocated inside of a larger registered range instead: registering memory inside of an already
+     * registered range reuses that registration. Released registrations stay mapped until their window is needed for
+     * another registration, least recently used first, until the memory is unregistered, or until the devices are
+     * closed.
+     *
+     * @param mmio_chip MMIO chip which accesses the memory.
+     * @param ptr Start of the memory.
+     * @param size Size of the memory, at most 1GB and at least the iATU region of its window.
+     * @return Address of ptr in the PCIe address space of the chip, in which host channel N starts at N GB.
+     */
+    uint64_t register_host_memory(chip_id_t mmio_chip, void* ptr, std::size_t size);
+    /**
+     * Drop a use of the registration covering ptr. It stays cached for later register_host_memory calls.
+     */
+    void release_host_memory(chip_id_t mmio_chip, void* ptr);
+    /**
+     * Unpin all registrations overlapping the memory, which must be released. Has to be called before the memory is
+     * freed.
+     */
+    void unregister_host_memory(chip_id_t mmio_chip, void* ptr, std::size_t size);
     virtual void write_to_sysmem(
         const void* mem_ptr, std::uint32_t size, uint64_t addr, uint16_t channel, chip_id_t src_device_id);
     virtual void read_from_sysmem(
         void* mem_ptr, uint64_t addr, uint16_t channel, uint32_t size, chip_id_t src_device_id);
+    // Span based versions of write_to_sysmem and read_from_sysmem. The data has to fit in the host channel.
+    void write_to_sysmem(Span<const std::uint8_t> data, uint64_t addr, uint16_t channel, chip_id_t src_device_id);
+    void read_from_sysmem(Span<std::uint8_t> data, uint64_t addr, uint16_t channel, chip_id_t src_device_id);
     virtual void wait_for_non_mmio_flush();
     virtual void wait_for_non_mmio_flush(const chip_id_t chip_id);
-    void l1_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {});
+    /**
+     * Memory barriers, which return once the writes issued before them have landed on the cores. On remote chips they
+     * first wait for the ethernet cores which carried writes to the chip, and then set and reset the barrier flags of
+     * the cores through ethernet, as on MMIO chips. Barriers on one chip do not wait for transfers to other chips.
+     */
+    void l1_membar(const chip_id_t chip, const std::string& fallback_tlb, const CoreSet& cores = {});
     void dram_membar(
         const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<uint32_t>& channels);
-    void dram_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {});
+    void dram_membar(const chip_id_t chip, const std::string& fallback_tlb, const CoreSet& cores = {});
     // These functions are used by Debuda, so make them public
     void bar_write32(int logical_device_id, uint32_t addr, uint32_t data);
     uint32_t bar_read32(int logical_device_id, uint32_t addr);
+    /**
+     * Execute a batch of 32-bit BAR register accesses on a single device, see PCIDevice::reg_batch.
+     *
+     * @param logical_device_id Logical id of an MMIO capable device.
+     * @param ops Register accesses, executed in order.
+     * @return Values of the read operations, in order.
+     */
+    std::vector<uint32_t> bar_batch32(int logical_device_id, const std::vector<reg_batch_op>& ops);
 
     /**
      * If the tlbs are initialized, returns a tuple with the TLB base address and its size
@@ -816,6 +1108,17 @@ public:
     static void harvest_rows_in_soc_descriptor(tt::ARCH arch, tt_SocDescriptor& sdesc, uint32_t harvested_rows);
     static std::unordered_map<tt_xy_pair, tt_xy_pair> create_harvested_coord_translation(
         const tt::ARCH arch, bool identity_map);
+    /**
+     * Generate the ERISC broadcast headers for a set of chips, grouped by the MMIO chip each broadcast goes through.
+     * Only depends on the cluster descriptor, get_ethernet_broadcast_headers caches the result per excluded chip set.
+     *
+     * @param first_mmio_chip MMIO chip used for all chips outside of the first shelf of the first rack.
+     */
+    static std::unordered_map<chip_id_t, std::vector<std::vector<int>>> generate_ethernet_broadcast_headers(
+        tt_ClusterDescriptor* cluster_desc,
+        const std::set<chip_id_t>& target_devices,
+        chip_id_t first_mmio_chip,
+        const std::set<chip_id_t>& chips_to_exclude);
     std::unordered_map<tt_xy_pair, tt_xy_pair> get_harvested_coord_translation_map(chip_id_t logical_device_id);
     virtual std::uint32_t get_num_dram_channels(std::uint32_t device_id);
     virtual std::uint64_t get_dram_channel_size(std::uint32_t device_id, std::uint32_t channel);
@@ -830,6 +1133,59 @@ public:
     virtual ~Cluster();
 
 private:
+    // Remote transfers through an MMIO chip of the cluster.
+    class MmioChipGateway : public RemoteTransferGateway {
+    public:
+        MmioChipGateway(Cluster& cluster, chip_id_t mmio_chip);
+
+        void write_to_eth_core(
+            const void* mem_ptr, std::uint32_t size_in_bytes, const tt_cxy_pair& eth_core, std::uint64_t address)
+            override;
+        void read_from_eth_core(
+            void* mem_ptr, const tt_cxy_pair& eth_core, std::uint64_t address, std::uint32_t size_in_bytes) override;
+        void write_to_sysmem(const void* mem_ptr, std::uint32_t size_in_bytes, std::uint64_t address) override;
+        void read_from_sysmem(void* mem_ptr, std::uint64_t address, std::uint32_t size_in_bytes) override;
+
+    private:
+        Cluster& cluster;
+        chip_id_t mmio_chip;
+    };
+
+    // MMIO chip carrying the remote transfers to a remote chip.
+    struct GatewayAssignment {
+        // Held in shared mode from picking the MMIO chip for a transfer until the transfer is queued, and exclusively
+        // while the transfers to the chip move to another MMIO chip.
+        std::shared_mutex mutex;
+        // Its closest MMIO chip, unless load balancing moved the transfers.
+        std::atomic<chip_id_t> mmio_chip = 0;
+    };
+
+    /**
+     * MMIO chip picked for a transfer, which keeps the target chip from moving to another MMIO chip until the lock is
+     * released. Transfers nested in one of the same thread, such as the flag writes of a memory barrier, reuse its MMIO
+     * chip without locking the assignment again.
+     */
+    class LockedGateway {
+    public:
+        // For MMIO chips and chips whose transfers are never moved, or transfers nested in a locked one.
+        explicit LockedGateway(chip_id_t mmio_chip) : mmio_chip(mmio_chip) {}
+
+        // Locks the assignment in shared mode, and reads its MMIO chip.
+        explicit LockedGateway(GatewayAssignment& assignment);
+
+        LockedGateway(LockedGateway&& other) noexcept;
+        LockedGateway& operator=(LockedGateway&&) = delete;
+        ~LockedGateway();
+
+        static bool is_held_by_this_thread(const GatewayAssignment& assignment);
+
+        chip_id_t get_mmio_chip() const { return mmio_chip; }
+
+    private:
+        GatewayAssignment* assignment = nullptr;
+        chip_id_t mmio_chip;
+    };
+
     // Helper functions
     // Startup + teardown
     void create_device(
@@ -841,6 +1197,12 @@ private:
     void cleanup_shared_host_state();
     void initialize_pcie_devices();
     void broadcast_pcie_tensix_risc_reset(chip_id_t chip_id, const TensixSoftResetOptions& cores);
+    void pcie_tensix_risc_reset_grid(
+        chip_id_t chip_id, const tt_xy_pair& start, const tt_xy_pair& end, const TensixSoftResetOptions& soft_resets);
+    void send_tensix_risc_reset_to_cores(
+        const chip_id_t chip, const CoreSet& cores, const TensixSoftResetOptions& soft_resets);
+    void set_harvested_coord_translation(
+        chip_id_t logical_device_id, const std::unordered_map<tt_xy_pair, tt_xy_pair>& translation);
     void broadcast_tensix_risc_reset_to_cluster(const TensixSoftResetOptions& soft_resets);
     void send_remote_tensix_risc_reset_to_core(const tt_cxy_pair& core, const TensixSoftResetOptions& soft_resets);
     void send_tensix_risc_reset_to_core(const tt_cxy_pair& core, const TensixSoftResetOptions& soft_resets);
@@ -865,28 +1227,86 @@ private:
     // Communication Functions
     void read_buffer(
         void* mem_ptr,
-        std::uint32_t address,
+        std::uint64_t address,
         std::uint16_t channel,
-        std::uint32_t size_in_bytes,
+        std::uint64_t size_in_bytes,
         chip_id_t src_device_id);
     void write_buffer(
-        const void* mem_ptr, std::uint32_t size, std::uint32_t address, std::uint16_t channel, chip_id_t src_device_id);
+        const void* mem_ptr, std::uint64_t size, std::uint64_t address, std::uint16_t channel, chip_id_t src_device_id);
     void write_device_memory(
         const void* mem_ptr,
-        uint32_t size_in_bytes,
+        uint64_t size_in_bytes,
         tt_cxy_pair target,
         uint64_t address,
         const std::string& fallback_tlb);
+    void write_device_memory(
+        const void* mem_ptr,
+        uint64_t size_in_bytes,
+        tt_cxy_pair target,
+        uint64_t address,
+        const std::string& fallback_tlb,
+        uint64_t fallback_ordering);
+    void write_device_memory(
+        SegmentList<const std::uint8_t>& source,
+        tt_cxy_pair target,
+        uint64_t address,
+        const std::string& fallback_tlb,
+        uint64_t fallback_ordering);
     void write_to_non_mmio_device(
         const void* mem_ptr,
-        uint32_t size_in_bytes,
+        uint64_t size_in_bytes,
         tt_cxy_pair core,
         uint64_t address,
         bool broadcast = false,
         std::vector<int> broadcast_header = {});
+    // Writes through mmio_chip, which for broadcasts is the chip the broadcast is sent from.
+    void write_to_non_mmio_device(
+        const void* mem_ptr,
+        uint64_t size_in_bytes,
+        tt_cxy_pair core,
+        uint64_t address,
+        chip_id_t mmio_chip,
+        bool broadcast,
+        std::vector<int> broadcast_header);
+    void write_to_non_mmio_device(
+        SegmentList<const std::uint8_t>& source,
+        tt_cxy_pair core,
+        uint64_t address,
+        chip_id_t mmio_chip,
+        bool broadcast,
+        std::vector<int> broadcast_header);
     void read_device_memory(
-        void* mem_ptr, tt_cxy_pair target, uint64_t address, uint32_t size_in_bytes, const std::string& fallback_tlb);
-    void read_from_non_mmio_device(void* mem_ptr, tt_cxy_pair core, uint64_t address, uint32_t size_in_bytes);
+        void* mem_ptr, tt_cxy_pair target, uint64_t address, uint64_t size_in_bytes, const std::string& fallback_tlb);
+    void read_device_memory(
+        SegmentList<std::uint8_t>& destination, tt_cxy_pair target, uint64_t address, const std::string& fallback_tlb);
+    // Static TLB the core is mapped to, if TLBs were set up for its chip. Only looks the maps up, so concurrent
+    // transfers can call it.
+    std::optional<std::int32_t> get_static_tlb_index(const tt_cxy_pair& target) const;
+    void read_from_non_mmio_device(void* mem_ptr, tt_cxy_pair core, uint64_t address, uint64_t size_in_bytes);
+    // Reads through mmio_chip. When sysmem_offset is set, block reads land at that offset of host channel 0 of
+    // mmio_chip, which mem_ptr must point to, instead of being copied out of the routing buffers.
+    void read_from_non_mmio_device(
+        void* mem_ptr,
+        tt_cxy_pair core,
+        uint64_t address,
+        uint64_t size_in_bytes,
+        chip_id_t mmio_chip,
+        std::optional<uint64_t> sysmem_offset);
+    void read_from_non_mmio_device(
+        SegmentList<std::uint8_t>& destination,
+        tt_cxy_pair core,
+        uint64_t address,
+        chip_id_t mmio_chip,
+        std::optional<uint64_t> sysmem_offset);
+    void dual_noc_striped_transfer(
+        PCIDevice* dev,
+        tt_cxy_pair target,
+        uint64_t address,
+        uint64_t size_in_bytes,
+        const std::string& fallback_tlb,
+        uint64_t ordering,
+        bool flush_noc1_writes,
+        const std::function<void(uint64_t, uint64_t, uint64_t)>& transfer_chunk);
     void read_mmio_device_register(
         void* mem_ptr, tt_cxy_pair core, uint64_t addr, uint32_t size, const std::string& fallback_tlb);
     void write_mmio_device_register(
@@ -910,19 +1330,16 @@ private:
         bool use_virtual_coords);
     void set_membar_flag(
         const chip_id_t chip,
-        const std::unordered_set<tt_xy_pair>& cores,
+        const CoreSet& cores,
         const uint32_t barrier_value,
         const uint32_t barrier_addr,
         const std::string& fallback_tlb);
     void insert_host_to_device_barrier(
         const chip_id_t chip,
-        const std::unordered_set<tt_xy_pair>& cores,
+        const CoreSet& cores,
         const uint32_t barrier_addr,
         const std::string& fallback_tlb);
     void init_membars();
-    uint64_t get_sys_addr(uint32_t chip_x, uint32_t chip_y, uint32_t noc_x, uint32_t noc_y, uint64_t offset);
-    uint16_t get_sys_rack(uint32_t rack_x, uint32_t rack_y);
-    bool is_non_mmio_cmd_q_full(uint32_t curr_wptr, uint32_t curr_rptr);
     int pcie_arc_msg(
         int logical_device_id,
         uint32_t msg_code,
@@ -942,8 +1359,8 @@ private:
         uint32_t* return_3 = nullptr,
         uint32_t* return_4 = nullptr);
     bool address_in_tlb_space(
-        uint64_t address, uint32_t size_in_bytes, int32_t tlb_index, uint64_t tlb_size, uint32_t chip);
-    std::shared_ptr<boost::interprocess::named_mutex> get_mutex(const std::string& tlb_name, int pci_interface_id);
+        uint64_t address, uint64_t size_in_bytes, int32_t tlb_index, uint64_t tlb_size, uint32_t chip);
+    std::shared_ptr<ProfiledNamedMutex> get_mutex(const std::string& tlb_name, int pci_interface_id);
     virtual uint32_t get_harvested_noc_rows_for_chip(
         int logical_device_id);  // Returns one-hot encoded harvesting mask for PCIe mapped chips
     void generate_tensix_broadcast_grids_for_grayskull(
@@ -959,6 +1376,33 @@ private:
 
     // This functions has to be called for local chip, and then it will wait for all connected remote chips to flush.
     void wait_for_connected_non_mmio_flush(chip_id_t chip_id);
+    // Waits for the commands queued on the ethernet cores of the MMIO chip, selected by their index in
+    // remote_transfer_ethernet_cores, to be processed and for their write acks to come back.
+    void wait_for_remote_transfer_cores(chip_id_t mmio_chip, std::uint32_t eth_core_mask);
+    // Returns the MMIO chip through which a transfer of size_in_bytes to the remote chip should go, locked until the
+    // transfer is queued.
+    LockedGateway get_remote_transfer_gateway(chip_id_t chip, uint64_t size_in_bytes);
+    // MMIO chip a transfer to chip goes through, the chip itself if it is MMIO capable.
+    LockedGateway get_transfer_gateway(chip_id_t chip, uint64_t size_in_bytes);
+    // Runs the transfers of each MMIO chip on a thread of its own and waits for all of them. A failure is rethrown
+    // once every transfer has finished.
+    static void run_per_gateway_in_parallel(const std::map<chip_id_t, std::function<void()>>& transfers_per_gateway);
+    uint32_t get_remote_transfer_queue_occupancy(chip_id_t mmio_chip);
+    HostMemoryRegistrationCache& get_host_memory_registration_cache(chip_id_t mmio_chip);
+    // Size of the smallest iATU region which can map size bytes at the start of a host memory window.
+    uint32_t get_host_memory_region_size(chip_id_t mmio_chip, uint32_t window, uint64_t size);
+    // Map a host memory window onto target, through the iATU region of region_size bytes.
+    void map_host_memory_window(chip_id_t mmio_chip, uint32_t window, uint64_t target, uint32_t region_size);
+    // Point the window away from its registration, before the registration is unpinned.
+    void unmap_host_memory_window(chip_id_t mmio_chip, uint32_t window);
+    // Unmap and unpin all host memory registrations of all chips.
+    void clear_host_memory_registrations();
+    void log_startup_phases(const std::string& stage);
+    // Identifies everything the device initialization in start_device depends on.
+    std::uint64_t get_session_fingerprint();
+    bool membar_flags_are_reset();
+    std::string get_transfer_profile_host();
+    void load_transfer_profile();
 
     void construct_cluster(
         const std::string& sdesc_path,
@@ -994,18 +1438,66 @@ private:
         NON_EPOCH_ETH_CORES_START_ID + NON_EPOCH_ETH_CORES_FOR_NON_MMIO_TRANSFERS;
     static constexpr std::uint32_t EPOCH_ETH_CORES_MASK = (EPOCH_ETH_CORES_FOR_NON_MMIO_TRANSFERS - 1);
 
-    int active_core = NON_EPOCH_ETH_CORES_START_ID;
+    // Maps indexed by MMIO chip are filled for every MMIO chip in create_device and only looked up afterwards, so
+    // threads driving different chips do not race on them.
+    // Ethernet core the next remote command through each MMIO chip goes to, if the cores were not customized. Only
+    // used with the NON_MMIO mutex of the chip held.
+    std::unordered_map<chip_id_t, int> active_core_per_chip = {};
     std::vector<std::vector<tt_cxy_pair>> remote_transfer_ethernet_cores;
-    std::unordered_map<chip_id_t, bool> flush_non_mmio_per_chip = {};
+    /**
+     * Remote writes queued on the ethernet cores of MMIO chips, numbered in the order they were queued. A flush
+     * waits for the cores carrying writes queued before it started, and only then marks them flushed, so that
+     * concurrent flushes each wait for the writes of their own thread.
+     */
+    class PendingRemoteWrites {
+    public:
+        // Called once a write is queued on the ethernet cores in eth_core_mask.
+        void add(std::uint32_t eth_core_mask);
+        // Mask of the ethernet cores carrying writes which are not flushed yet, and the number of the last write.
+        std::pair<std::uint32_t, std::uint64_t> get_unflushed();
+        // Called once the cores returned by get_unflushed were waited for.
+        void set_flushed(std::uint64_t write_number);
+
+    private:
+        std::mutex mutex;
+        std::uint64_t queued = 0;
+        std::uint64_t flushed = 0;
+        // Number of the last write queued on each ethernet core, by index in remote_transfer_ethernet_cores.
+        std::array<std::uint64_t, 32> last_queued_per_core = {};
+    };
+    // Remote writes queued through each MMIO chip, waited for by wait_for_connected_non_mmio_flush.
+    std::unordered_map<chip_id_t, PendingRemoteWrites> flush_non_mmio_per_chip = {};
+    // Writes to each remote chip, so that flushing it only waits for the ethernet cores which carried them.
+    std::unordered_map<chip_id_t, PendingRemoteWrites> eth_cores_to_flush_per_remote_chip = {};
     bool non_mmio_transfer_cores_customized = false;
+    std::atomic<bool> remote_transfer_load_balancing = false;
+    std::atomic<uint32_t> remote_transfer_max_extra_hops = 0;
+    std::atomic<uint32_t> remote_transfer_load_balancing_min_size = 0;
+    std::unordered_map<chip_id_t, GatewayAssignment> remote_transfer_gateway_per_chip = {};
+    std::unordered_map<chip_id_t, HostMemoryRegistrationCache> host_memory_registrations = {};
+    // Host memory window of each iATU region programmed for registrations, by chip and region id.
+    std::unordered_map<chip_id_t, std::map<uint32_t, uint32_t>> host_memory_window_per_region = {};
+    std::mutex host_memory_registration_mutex;
+    PhaseProfiler startup_profiler;
+    // Indexed by PCI interface id.
+    std::map<int, std::unique_ptr<SessionRecord>> session_records = {};
+    bool session_resumed = false;
+    TransferProfile transfer_profile;
+    RemoteTransferEngine remote_transfer_engine{
+        eth_interface_params, host_address_params, noc_params, transfer_profile};
+    // Whether this cluster started the trace, and has to stop it when it is destroyed.
+    bool owns_trace = false;
     std::unordered_map<chip_id_t, int> active_eth_core_idx_per_chip = {};
     std::unordered_map<chip_id_t, bool> noc_translation_enabled_for_chip = {};
-    std::map<std::string, std::shared_ptr<boost::interprocess::named_mutex>> hardware_resource_mutex_map = {};
-    std::unordered_map<chip_id_t, std::unordered_map<tt_xy_pair, tt_xy_pair>> harvested_coord_translation = {};
+    // Indexed by PCI interface id, declared before the mutexes which record into them.
+    std::map<int, std::unique_ptr<LockStatsTable>> lock_stats_tables = {};
+    std::map<std::string, std::shared_ptr<ProfiledNamedMutex>> hardware_resource_mutex_map = {};
+    // Indexed by chip id.
+    std::vector<CoordTranslationTable> harvested_coord_translation = {};
     std::unordered_map<chip_id_t, std::uint32_t> num_rows_harvested = {};
-    std::unordered_map<chip_id_t, std::unordered_set<tt_xy_pair>> workers_per_chip = {};
-    std::unordered_set<tt_xy_pair> eth_cores = {};
-    std::unordered_set<tt_xy_pair> dram_cores = {};
+    std::unordered_map<chip_id_t, CoreSet> workers_per_chip = {};
+    CoreSet eth_cores = {};
+    CoreSet dram_cores = {};
     std::map<chip_id_t, std::unordered_map<int32_t, uint64_t>> tlb_config_map = {};
     std::set<chip_id_t> all_target_mmio_devices;
 
@@ -1015,7 +1507,18 @@ private:
 
     std::unordered_map<std::string, std::int32_t> dynamic_tlb_config = {};
     std::unordered_map<std::string, uint64_t> dynamic_tlb_ordering_modes = {};
+    // Dynamic TLB used for the NOC1 half of striped transfers, empty if striping is disabled.
+    std::string dual_noc_striping_tlb = "";
+    uint32_t dual_noc_striping_chunk_size = 0;
+    uint32_t dual_noc_striping_min_size = 0;
+    struct PendingPostedWrites {
+        std::mutex mutex;
+        // Last written (4 byte aligned) address per core, for posted writes not yet covered by a posted_write_barrier.
+        std::unordered_map<tt_xy_pair, uint64_t> last_word_addr_per_core;
+    };
+    std::unordered_map<chip_id_t, PendingPostedWrites> pending_posted_writes_per_chip = {};
     std::map<std::set<chip_id_t>, std::unordered_map<chip_id_t, std::vector<std::vector<int>>>> bcast_header_cache = {};
+    std::mutex bcast_header_cache_mutex;
     bool perform_harvesting_on_sdesc = false;
     bool use_ethernet_ordered_writes = true;
     bool use_ethernet_broadcast = true;
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "umd/device/tt_xy_pair.h"
+
+namespace tt::umd {
+
+/**
+ * Translation of NOC coordinates for a single chip, stored as a dense array over the chip's NOC grid.
+ * Lookups are a bounds check and an index computation, so programming a TLB does not hash coordinates.
+ */
+class CoordTranslationTable {
+public:
+    CoordTranslationTable() = default;
+
+    /**
+     * Builds the table from a translation map. The map has to cover every core of a rectangular grid
+     * starting at (0, 0). noc_translation_enabled tells whether the chip translates NOC coordinates in hardware.
+     */
+    CoordTranslationTable(
+        const std::unordered_map<tt_xy_pair, tt_xy_pair>& translation, bool noc_translation_enabled = false);
+
+    // Throws std::out_of_range for cores outside of the grid, the same as std::unordered_map::at.
+    const tt_xy_pair& at(const tt_xy_pair& core) const {
+        if (core.x >= grid_size.x || core.y >= grid_size.y) {
+            throw std::out_of_range("Core " + core.str() + " is outside of the coordinate translation table.");
+        }
+        return table[core.y * grid_size.x + core.x];
+    }
+
+    tt_xy_pair get_grid_size() const { return grid_size; }
+
+    // Translated coordinates name the same core on both NOCs, physical ones are mirrored on NOC1.
+    bool is_noc_translation_enabled() const { return noc_translation_enabled; }
+
+    std::unordered_map<tt_xy_pair, tt_xy_pair> to_map() const;
+
+private:
+    tt_xy_pair grid_size = {0, 0};
+    bool noc_translation_enabled = false;
+    // Row major, indexed by y * grid_size.x + x.
+    std::vector<tt_xy_pair> table = {};
+};
+
+}  // namespace tt::umd
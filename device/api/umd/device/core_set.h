@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "umd/device/tt_xy_pair.h"
+
+namespace tt::umd {
+
+/**
+ * Set of cores of a single chip, stored as a bitset over the NOC grid with one 64 bit word per row.
+ * Set operations work on whole rows at a time and iteration visits cores in NOC order (row by row, increasing x).
+ * Coordinates up to MAX_GRID_DIM - 1 in both dimensions can be stored.
+ */
+class CoreSet {
+public:
+    static constexpr std::size_t MAX_GRID_DIM = 64;
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = tt_xy_pair;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const tt_xy_pair*;
+        using reference = tt_xy_pair;
+
+        const_iterator() = default;
+
+        tt_xy_pair operator*() const { return tt_xy_pair(__builtin_ctzll(row_bits), row); }
+
+        const_iterator& operator++() {
+            row_bits &= row_bits - 1;
+            if (row_bits == 0) {
+                advance_to_next_row(row + 1);
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const { return row == other.row && row_bits == other.row_bits; }
+
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class CoreSet;
+
+        const_iterator(const CoreSet* set, std::size_t first_row) : set(set) { advance_to_next_row(first_row); }
+
+        void advance_to_next_row(std::size_t next_row) {
+            for (row = next_row; row < MAX_GRID_DIM; row++) {
+                row_bits = set->rows[row];
+                if (row_bits) {
+                    return;
+                }
+            }
+            row_bits = 0;
+        }
+
+        const CoreSet* set = nullptr;
+        std::size_t row = MAX_GRID_DIM;
+        // Cores of the current row which have not been visited yet.
+        std::uint64_t row_bits = 0;
+    };
+
+    CoreSet() = default;
+
+    // Implicit, so that APIs taking a CoreSet keep accepting the core collections used so far.
+    CoreSet(std::initializer_list<tt_xy_pair> cores);
+    CoreSet(const std::vector<tt_xy_pair>& cores);
+    CoreSet(const std::unordered_set<tt_xy_pair>& cores);
+
+    /**
+     * Set containing all cores of the [start, end] rectangle, both corners inclusive.
+     */
+    static CoreSet rectangle(const tt_xy_pair& start, const tt_xy_pair& end);
+
+    // Throws std::out_of_range for cores outside of the supported grid.
+    void insert(const tt_xy_pair& core) {
+        check_in_range(core);
+        rows[core.y] |= bit(core.x);
+    }
+
+    void erase(const tt_xy_pair& core) {
+        if (core.x < MAX_GRID_DIM && core.y < MAX_GRID_DIM) {
+            rows[core.y] &= ~bit(core.x);
+        }
+    }
+
+    bool contains(const tt_xy_pair& core) const {
+        return core.x < MAX_GRID_DIM && core.y < MAX_GRID_DIM && (rows[core.y] & bit(core.x));
+    }
+
+    std::size_t size() const;
+
+    bool empty() const;
+
+    void clear() { rows.fill(0); }
+
+    bool is_subset_of(const CoreSet& other) const;
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    const_iterator end() const { return const_iterator(); }
+
+    CoreSet& operator|=(const CoreSet& other);
+    CoreSet& operator&=(const CoreSet& other);
+    CoreSet& operator-=(const CoreSet& other);
+
+    friend CoreSet operator|(CoreSet lhs, const CoreSet& rhs) { return lhs |= rhs; }
+
+    friend CoreSet operator&(CoreSet lhs, const CoreSet& rhs) { return lhs &= rhs; }
+
+    friend CoreSet operator-(CoreSet lhs, const CoreSet& rhs) { return lhs -= rhs; }
+
+    friend bool operator==(const CoreSet& lhs, const CoreSet& rhs) { return lhs.rows == rhs.rows; }
+
+    friend bool operator!=(const CoreSet& lhs, const CoreSet& rhs) { return !(lhs == rhs); }
+
+    /**
+     * Decompose the set into disjoint rectangles which together cover exactly the cores of the set.
+     * Rectangles are returned as inclusive (start, end) corner pairs, ordered by their start core in NOC order.
+     * Rectangles are grown greedily: first along the row, then down as long as the next rows contain the whole span.
+     */
+    std::vector<std::pair<tt_xy_pair, tt_xy_pair>> to_rectangles() const;
+
+    /**
+     * If the set holds exactly the cores at the crossings of some rows and columns, return them as (row mask, column
+     * mask), with bit y of the row mask set for row y and bit x of the column mask set for column x. Such a set is
+     * reachable with a single row/column masked broadcast. Returns std::nullopt otherwise, and for the empty set.
+     */
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> to_rows_and_columns() const;
+
+    std::unordered_set<tt_xy_pair> to_unordered_set() const;
+
+private:
+    static std::uint64_t bit(std::size_t x) { return std::uint64_t(1) << x; }
+
+    // Bits start_x to end_x inclusive, computed so that a span covering the whole row does not shift by 64.
+    static std::uint64_t row_span(std::size_t start_x, std::size_t end_x) {
+        return (~std::uint64_t(0) >> (MAX_GRID_DIM - 1 - end_x)) & (~std::uint64_t(0) << start_x);
+    }
+
+    static void check_in_range(const tt_xy_pair& core) {
+        if (core.x >= MAX_GRID_DIM || core.y >= MAX_GRID_DIM) {
+            throw std::out_of_range("Core " + core.str() + " is outside of the grid supported by CoreSet.");
+        }
+    }
+
+    // Bit x of rows[y] is set when core (x, y) is in the set.
+    std::array<std::uint64_t, MAX_GRID_DIM> rows = {};
+};
+
+}  // namespace tt::umd
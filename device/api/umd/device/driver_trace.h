@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tt::umd {
+
+enum class TraceCategory : std::uint8_t {
+    Transfer,
+    TlbReprogram,
+    MutexWait,
+    EthernetQueueFull,
+    Membar,
+    ArcMessage,
+};
+
+const char* trace_category_name(TraceCategory category);
+
+struct TraceEvent {
+    // Has to outlive the trace, in practice a string literal.
+    const char* name = nullptr;
+    TraceCategory category = TraceCategory::Transfer;
+    // Chip the event is about, or -1 if it only goes on the thread track.
+    std::int32_t chip = -1;
+    // Bytes transferred or message code, 0 if it does not apply.
+    std::uint64_t arg = 0;
+    std::uint64_t start_ns = 0;
+    std::uint64_t duration_ns = 0;
+};
+
+/**
+ * Fixed capacity ring of trace events with a single producer and a single consumer, which do not lock each other.
+ * Events pushed while the ring is full are dropped and counted.
+ */
+class TraceRing {
+public:
+    // Capacity is rounded up to a power of two.
+    explicit TraceRing(std::size_t capacity);
+
+    // Producer side.
+    bool push(const TraceEvent& event);
+
+    // Consumer side, appends all events currently in the ring to events and returns how many there were.
+    std::size_t drain(std::vector<TraceEvent>& events);
+
+    std::uint64_t get_dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<TraceEvent> events;
+    std::size_t mask;
+    // Next slot to be written, only advanced by the producer.
+    std::atomic<std::uint64_t> head = 0;
+    // Next slot to be read, only advanced by the consumer.
+    std::atomic<std::uint64_t> tail = 0;
+    std::atomic<std::uint64_t> dropped = 0;
+};
+
+/**
+ * Process wide recording of driver activity, written as Chrome trace JSON which chrome://tracing and the Perfetto UI
+ * can open. Every host thread has its own track, and events about a chip are also shown on a track for that chip.
+ * Threads record into their own TraceRing, which a background thread drains into the file, so recording an event
+ * never does I/O or takes a lock.
+ */
+class DriverTrace {
+public:
+    /**
+     * Start recording to trace_file_path, which is overwritten. Throws std::runtime_error if a trace is already being
+     * recorded or the file can not be opened.
+     *
+     * @param ring_capacity Events buffered per thread before further events of that thread are dropped.
+     * @param flush_interval How often the background thread moves buffered events to the file.
+     */
+    static void start(
+        const std::string& trace_file_path,
+        std::size_t ring_capacity = 64 * 1024,
+        std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100));
+
+    /**
+     * Write the remaining events and close the trace file. Does nothing if no trace is being recorded.
+     */
+    static void stop();
+
+    static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // Events dropped because the ring of the recording thread was full, since the trace was started.
+    static std::uint64_t get_dropped_events();
+
+    static void record(const TraceEvent& event);
+
+    static std::uint64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+/**
+ * Records an event covering its lifetime, or until end is called. Costs a single relaxed load when tracing is off.
+ */
+class TraceScope {
+public:
+    TraceScope(const char* name, TraceCategory category, std::int32_t chip = -1, std::uint64_t arg = 0) {
+        if (DriverTrace::is_enabled()) {
+            event.name = name;
+            event.category = category;
+            event.chip = chip;
+            event.arg = arg;
+            event.start_ns = DriverTrace::now_ns();
+        }
+    }
+
+    ~TraceScope() { end(); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    void end() {
+        if (event.name != nullptr) {
+            event.duration_ns = DriverTrace::now_ns() - event.start_ns;
+            DriverTrace::record(event);
+            event.name = nullptr;
+        }
+    }
+
+private:
+    TraceEvent event;
+};
+
+}  // namespace tt::umd
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tt::umd {
+
+// Host memory pinned for device access and mapped through one of the device's host memory windows.
+struct HostMemoryRegistration {
+    std::uintptr_t start = 0;
+    std::size_t size = 0;
+    // Address of start on the device side of the IOMMU, or its physical address if there is none.
+    std::uint64_t iova = 0;
+    // Host memory window through which the device reaches the registration.
+    std::uint32_t window = 0;
+    // Number of register calls not matched by a release yet.
+    std::uint32_t users = 0;
+    std::uint64_t last_use = 0;
+};
+
+/**
+ * Bookkeeping for registrations of host memory of a single device, which only has a few windows to map them through.
+ * Registrations stay cached after their last user releases them, so that registering the same memory again does not
+ * pin it again. When all windows are taken, the least recently used registration without users is evicted.
+ * The cache does not pin or map memory itself, evicted and invalidated registrations are returned to the caller.
+ */
+class HostMemoryRegistrationCache {
+public:
+    explicit HostMemoryRegistrationCache(std::vector<std::uint32_t> windows);
+
+    /**
+     * Find a registration which covers [address, address + size), and add a user to it.
+     */
+    std::optional<HostMemoryRegistration> acquire(std::uintptr_t address, std::size_t size);
+
+    /**
+     * Find a window for a new registration. If none is free, the least recently used registration without users is
+     * evicted and returned through evicted. Throws std::runtime_error if every window is in use.
+     */
+    std::uint32_t allocate_window(std::optional<HostMemoryRegistration>& evicted);
+
+    /**
+     * Add a registration with a single user, in a window returned by allocate_window.
+     */
+    void insert(HostMemoryRegistration registration);
+
+    /**
+     * Remove a user from the registration covering address. Throws std::invalid_argument if there is none.
+     */
+    void release(std::uintptr_t address);
+
+    /**
+     * Remove all registrations overlapping [address, address + size), for memory which is about to be freed.
+     * Throws std::runtime_error if any of them still has users.
+     */
+    std::vector<HostMemoryRegistration> invalidate(std::uintptr_t address, std::size_t size);
+
+    /**
+     * Remove all registrations, regardless of their users.
+     */
+    std::vector<HostMemoryRegistration> clear();
+
+    std::size_t size() const { return registrations.size(); }
+
+private:
+    std::vector<std::uint32_t> free_windows;
+    std::vector<HostMemoryRegistration> registrations;
+    std::uint64_t use_counter = 0;
+};
+
+}  // namespace tt::umd
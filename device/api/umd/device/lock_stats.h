@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost::interprocess {
+class named_mutex;
+class mapped_region;
+}  // namespace boost::interprocess
+
+namespace tt::umd {
+
+// Usage of one interprocess mutex, summed over all processes which used it.
+struct LockStats {
+    std::string name;
+    std::uint64_t acquisitions = 0;
+    // Acquisitions which found the mutex held by someone else.
+    std::uint64_t contended_acquisitions = 0;
+    std::chrono::nanoseconds total_wait = {};
+    std::chrono::nanoseconds max_wait = {};
+    std::chrono::nanoseconds total_hold = {};
+    std::chrono::nanoseconds max_hold = {};
+    // Current holder, 0 if the mutex is free.
+    std::int32_t holder_pid = 0;
+    std::int32_t holder_tid = 0;
+    // How long the current holder has held the mutex.
+    std::chrono::nanoseconds current_hold = {};
+};
+
+struct LockStatsSlot;
+
+/**
+ * Shared memory table with the LockStats of the interprocess mutexes of a single PCI device. It outlives the
+ * processes using the mutexes, so it can be read by another process, see read_lock_stats.
+ */
+class LockStatsTable {
+public:
+    static constexpr std::size_t MAX_LOCKS = 64;
+    static constexpr std::size_t MAX_LOCK_NAME_LENGTH = 47;
+
+    // Opens the table of the device, creating it if it does not exist yet.
+    explicit LockStatsTable(int pci_interface_id);
+    ~LockStatsTable();
+
+    static std::string get_shared_memory_name(int pci_interface_id);
+    static void remove(int pci_interface_id);
+
+    // Slot of the mutex with the given name, taking a free one if the mutex has none yet.
+    LockStatsSlot* get_slot(const std::string& name);
+
+    std::vector<LockStats> read() const;
+    // Clears the counters of all mutexes. The current holders are kept.
+    void reset();
+
+private:
+    std::unique_ptr<boost::interprocess::mapped_region> region;
+    LockStatsSlot* slots;
+};
+
+/**
+ * Stats of the interprocess mutexes of the device, or an empty vector if no process has created them. Does not need
+ * the device to be opened, so it can be used to inspect a running workload.
+ */
+std::vector<LockStats> read_lock_stats(int pci_interface_id);
+
+/**
+ * Interprocess named mutex which records its wait and hold times, and its holder, into a LockStatsTable.
+ * Satisfies the Lockable requirements, so it can be used with the usual scoped locks.
+ */
+class ProfiledNamedMutex {
+public:
+    ProfiledNamedMutex(std::unique_ptr<boost::interprocess::named_mutex> mutex, LockStatsSlot* stats);
+    ~ProfiledNamedMutex();
+
+    void lock();
+    bool try_lock();
+    void unlock();
+
+private:
+    void record_acquisition(std::uint64_t wait_ns, bool contended);
+
+    std::unique_ptr<boost::interprocess::named_mutex> mutex;
+    LockStatsSlot* stats;
+};
+
+}  // namespace tt::umd
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "fmt/format.h"
+#include "umd/device/coord_translation_table.h"
 #include "umd/device/semver.hpp"
 #include "umd/device/tlb.h"
 #include "umd/device/tt_arch_types.h"
@@ -47,6 +48,24 @@ struct hugepage_mapping {
     uint64_t physical_address = 0;
 };
 
+// A single 32-bit register access in a batch, see PCIDevice::reg_batch.
+struct reg_batch_op {
+    enum class Type { Read, Write, Modify };
+
+    Type type;
+    uint32_t byte_addr;
+    uint32_t value = 0;
+    uint32_t mask = 0xffffffff;  // Modify only: bits of value that are written, the rest are preserved.
+
+    static reg_batch_op read(uint32_t byte_addr) { return {Type::Read, byte_addr}; }
+
+    static reg_batch_op write(uint32_t byte_addr, uint32_t value) { return {Type::Write, byte_addr, value}; }
+
+    static reg_batch_op modify(uint32_t byte_addr, uint32_t value, uint32_t mask) {
+        return {Type::Modify, byte_addr, value, mask};
+    }
+};
+
 struct PciDeviceInfo {
     uint16_t vendor_id;
     uint16_t device_id;
@@ -64,6 +83,11 @@ struct PciDeviceInfo {
 using tt::umd::semver_t;
 
 class PCIDevice {
+public:
+    // Reads smaller than this are not worth the alignment fix-ups of the streaming path.
+    static constexpr std::size_t DEFAULT_STREAMING_READ_MIN_SIZE = 128;
+
+private:
     const std::string device_path;   // Path to character device: /dev/tenstorrent/N
     const int pci_device_num;        // N in /dev/tenstorrent/N
     const int pci_device_file_desc;  // Character device file descriptor
@@ -114,6 +138,16 @@ public:
      */
     int get_numa_node() const { return numa_node; }
 
+    /**
+     * @return current PCIe link speed in GT/s, e.g. 16.0 for the "16.0 GT/s PCIe" reported by sysfs, or 0 if unknown
+     */
+    double get_link_speed() const;
+
+    /**
+     * @return current number of PCIe lanes, or 0 if unknown
+     */
+    int get_link_width() const;
+
     /**
      * @return underlying file descriptor
      * TODO: this is an abstraction violation to be removed when this class
@@ -156,10 +190,29 @@ public:
     // before doing too much work here...
     void write_block(uint64_t byte_addr, uint64_t num_bytes, const uint8_t *buffer_addr);
     void read_block(uint64_t byte_addr, uint64_t num_bytes, uint8_t *buffer_addr);
+
+    /**
+     * Reads by read_block from write-combined mappings of at least this size use wide streaming loads, if the CPU
+     * supports them. Other reads use the word copy.
+     */
+    void set_streaming_read_min_size(std::size_t size) { streaming_read_min_size = size; }
+    std::size_t get_streaming_read_min_size() const { return streaming_read_min_size; }
+
     void write_regs(uint32_t byte_addr, uint32_t word_len, const void *data);
     void write_regs(volatile uint32_t *dest, const uint32_t *src, uint32_t word_len);
     void read_regs(uint32_t byte_addr, uint32_t word_len, void *data);
 
+    /**
+     * Execute a sequence of 32-bit register accesses in order.
+     *
+     * Fences are only issued where a write to a write-combined mapping has to become visible before a subsequent
+     * read, and once at the end of the batch if such writes are still outstanding.
+     *
+     * @param ops Register accesses, executed in order.
+     * @return Values of Read operations, in the order in which they appear in ops.
+     */
+    std::vector<uint32_t> reg_batch(const std::vector<reg_batch_op> &ops);
+
     // TLB related functions.
     // TODO: These are architecture specific, and will be moved out of the class.
     void write_tlb_reg(
@@ -170,18 +223,20 @@ public:
         tt_xy_pair end,
         std::uint64_t address,
         bool multicast,
-        std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
-        std::uint64_t ordering);
+        const tt::umd::CoordTranslationTable &harvested_coord_translation,
+        std::uint64_t ordering,
+        std::uint64_t noc_sel = 0);
     dynamic_tlb set_dynamic_tlb(
         unsigned int tlb_index,
         tt_xy_pair target,
         std::uint64_t address,
-        std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
-        std::uint64_t ordering = tt::umd::tlb_data::Relaxed);
+        const tt::umd::CoordTranslationTable &harvested_coord_translation,
+        std::uint64_t ordering = tt::umd::tlb_data::Relaxed,
+        std::uint64_t noc_sel = 0);
     dynamic_tlb set_dynamic_tlb_broadcast(
         unsigned int tlb_index,
         std::uint64_t address,
-        std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
+        const tt::umd::CoordTranslationTable &harvested_coord_translation,
         tt_xy_pair start,
         tt_xy_pair end,
         std::uint64_t ordering = tt::umd::tlb_data::Relaxed);
@@ -194,6 +249,16 @@ public:
     int get_num_host_mem_channels() const;
     hugepage_mapping get_hugepage_mapping(int channel) const;
 
+    /**
+     * Pin host memory so that the device can access it. Without an IOMMU the memory has to be physically contiguous.
+     *
+     * @param address Page aligned start of the memory.
+     * @param size Size of the memory, a multiple of the page size.
+     * @return Address of the memory on the device side of the IOMMU, or its physical address if there is none.
+     */
+    uint64_t pin_host_memory(void *address, size_t size);
+    void unpin_host_memory(void *address, size_t size);
+
 public:
     // TODO: we can and should make all of these private.
     void *bar0_uc = nullptr;
@@ -230,5 +295,10 @@ private:
 
     semver_t read_kmd_version();
 
+    // Maps and pins the hugepage of a single host memory channel, called from init_hugepage.
+    bool init_hugepage_channel(const std::string &hugepage_dir, uint16_t channel);
+
     std::vector<hugepage_mapping> hugepage_mapping_per_channel;
+
+    std::size_t streaming_read_min_size = DEFAULT_STREAMING_READ_MIN_SIZE;
 };
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace tt::umd {
+
+struct PhaseTiming {
+    std::string name;
+    // Number of phases this one is nested in.
+    int depth = 0;
+    std::chrono::steady_clock::duration duration = {};
+};
+
+/**
+ * Wall clock timing of the phases of a longer operation, such as bringing up a cluster.
+ * Phases are recorded in the order in which they start, and phases started while another one runs are nested in it.
+ */
+class PhaseProfiler {
+public:
+    class ScopedPhase {
+    public:
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+    private:
+        friend class PhaseProfiler;
+
+        ScopedPhase(PhaseProfiler* profiler, std::size_t phase) : profiler(profiler), phase(phase) {}
+
+        PhaseProfiler* profiler;
+        std::size_t phase;
+    };
+
+    /**
+     * Start timing a phase, which ends when the returned object goes out of scope.
+     */
+    [[nodiscard]] ScopedPhase measure(std::string name) { return ScopedPhase(this, begin(std::move(name))); }
+
+    /**
+     * Start timing a phase which does not match a scope. Returns the phase to pass to end.
+     */
+    std::size_t begin(std::string name);
+    void end(std::size_t phase);
+
+    const std::vector<PhaseTiming>& get_phases() const { return phases; }
+
+    // Sum of the durations of the phases which are not nested in another one.
+    std::chrono::steady_clock::duration get_total_duration() const;
+
+    // One line per phase with its duration in milliseconds, nested phases indented under their parent.
+    std::string summary() const;
+
+    void clear();
+
+private:
+    std::vector<PhaseTiming> phases;
+    std::vector<std::chrono::steady_clock::time_point> phase_starts;
+    int depth = 0;
+};
+
+}  // namespace tt::umd
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "umd/device/span.h"
+#include "umd/device/transfer_profile.h"
+#include "umd/device/tt_cluster_descriptor_types.h"
+#include "umd/device/tt_xy_pair.h"
+
+struct tt_driver_eth_interface_params;
+struct tt_driver_host_address_params;
+struct tt_driver_noc_params;
+
+namespace tt::umd {
+
+// Command in the request and response queues of the ethernet firmware, the same on Wormhole and Blackhole.
+struct routing_cmd_t {
+    uint64_t sys_addr;
+    uint32_t data;
+    uint32_t flags;
+    uint16_t rack;
+    uint16_t src_resp_buf_index;
+    uint32_t local_buf_index;
+    uint8_t src_resp_q_id;
+    uint8_t host_mem_txn_id;
+    uint16_t padding;
+    uint32_t src_addr_tag;  // upper 32-bits of request source address.
+};
+
+struct remote_update_ptr_t {
+    uint32_t ptr;
+    uint32_t pad[3];
+};
+
+/**
+ * Access to the MMIO chip remote transfers are tunnelled through: the L1 of its ethernet cores, which hold the command
+ * queues of the ethernet firmware, and channel 0 of its host memory, which holds the routing buffers.
+ */
+class RemoteTransferGateway {
+public:
+    virtual ~RemoteTransferGateway() = default;
+
+    virtual void write_to_eth_core(
+        const void* mem_ptr, std::uint32_t size_in_bytes, const tt_cxy_pair& eth_core, std::uint64_t address) = 0;
+    virtual void read_from_eth_core(
+        void* mem_ptr, const tt_cxy_pair& eth_core, std::uint64_t address, std::uint32_t size_in_bytes) = 0;
+    virtual void write_to_sysmem(const void* mem_ptr, std::uint32_t size_in_bytes, std::uint64_t address) = 0;
+    virtual void read_from_sysmem(void* mem_ptr, std::uint64_t address, std::uint32_t size_in_bytes) = 0;
+};
+
+/**
+ * Ethernet cores of the MMIO chip whose queues carry remote writes. Writes are queued on the active core, and move on
+ * to the next one of the cores first_core to first_core + core_mask whenever its queue fills up.
+ */
+struct RemoteTransferCores {
+    const std::vector<tt_cxy_pair>& eth_cores;
+    int& active_core;
+    int first_core;
+    std::uint32_t core_mask;
+};
+
+/**
+ * Host side of the protocol through which the ethernet firmware of an MMIO chip carries reads and writes to the chips
+ * connected to it over ethernet. Shared by Wormhole and Blackhole, whose firmware queues only differ in the parameters
+ * the engine is built with. Callers serialize the transfers through the same gateway, see "NON_MMIO_MUTEX Usage" in
+ * cluster.cpp.
+ */
+class RemoteTransferEngine {
+public:
+    // The parameters and profile are referenced, so that later changes to them apply to the following transfers.
+    RemoteTransferEngine(
+        const tt_driver_eth_interface_params& eth_interface_params,
+        const tt_driver_host_address_params& host_address_params,
+        const tt_driver_noc_params& noc_params,
+        const TransferProfile& transfer_profile);
+
+    /**
+     * Queue a write of size_in_bytes to address of core, in NOC coordinates, on the remote chip at target_chip. Returns
+     * once every command is queued, the mask of the cores, by index in cores.eth_cores, they were queued on. A
+     * broadcast writes to address on every chip and core the broadcast header does not exclude.
+     */
+    std::uint32_t write(
+        RemoteTransferGateway& gateway,
+        const RemoteTransferCores& cores,
+        const void* mem_ptr,
+        std::uint64_t size_in_bytes,
+        const eth_coord_t& target_chip,
+        const tt_xy_pair& core,
+        std::uint64_t address,
+        bool broadcast = false,
+        const std::vector<int>& broadcast_header = {});
+    // Write of the concatenation of the segments, each copied straight into the routing buffers.
+    std::uint32_t write(
+        RemoteTransferGateway& gateway,
+        const RemoteTransferCores& cores,
+        SegmentList<const std::uint8_t>& source,
+        const eth_coord_t& target_chip,
+        const tt_xy_pair& core,
+        std::uint64_t address,
+        bool broadcast = false,
+        const std::vector<int>& broadcast_header = {});
+
+    /**
+     * Read size_in_bytes from address of core, in NOC coordinates, on the remote chip at target_chip, through the
+     * queues of eth_core. With sysmem_offset the data is written by the firmware straight to that offset of host
+     * channel 0, which mem_ptr has to map, instead of being copied from the routing buffers.
+     */
+    void read(
+        RemoteTransferGateway& gateway,
+        const tt_cxy_pair& eth_core,
+        void* mem_ptr,
+        const eth_coord_t& target_chip,
+        const tt_xy_pair& core,
+        std::uint64_t address,
+        std::uint64_t size_in_bytes,
+        std::optional<std::uint64_t> sysmem_offset = std::nullopt);
+    // Read into the segments as if they were one buffer, each filled straight from the routing buffers.
+    void read(
+        RemoteTransferGateway& gateway,
+        const tt_cxy_pair& eth_core,
+        SegmentList<std::uint8_t>& destination,
+        const eth_coord_t& target_chip,
+        const tt_xy_pair& core,
+        std::uint64_t address,
+        std::optional<std::uint64_t> sysmem_offset = std::nullopt);
+
+    /**
+     * Wait for the commands queued on eth_cores, selected by eth_core_mask, to be processed and for their write acks
+     * to come back.
+     */
+    void wait_for_cores(
+        RemoteTransferGateway& gateway, const std::vector<tt_cxy_pair>& eth_cores, std::uint32_t eth_core_mask);
+
+    // Number of commands queued on eth_core which the firmware did not pick up yet.
+    std::uint32_t get_queue_occupancy(RemoteTransferGateway& gateway, const tt_cxy_pair& eth_core);
+
+    // Size of the blocks remote transfers staged in host memory are split into.
+    std::uint32_t get_dram_block_size() const;
+
+    std::uint64_t get_sys_addr(
+        std::uint32_t chip_x, std::uint32_t chip_y, std::uint32_t noc_x, std::uint32_t noc_y, std::uint64_t offset)
+        const;
+    std::uint16_t get_sys_rack(std::uint32_t rack_x, std::uint32_t rack_y) const;
+    bool is_cmd_q_full(std::uint32_t curr_wptr, std::uint32_t curr_rptr) const;
+
+private:
+    // Request queue write and read pointers of eth_core, in words 0 and 4.
+    void read_request_q_ptrs(
+        RemoteTransferGateway& gateway, const tt_cxy_pair& eth_core, std::vector<std::uint32_t>& erisc_q_ptrs);
+    void push_command(
+        RemoteTransferGateway& gateway,
+        const tt_cxy_pair& eth_core,
+        const routing_cmd_t& command,
+        std::vector<std::uint32_t>& erisc_q_ptrs);
+
+    const tt_driver_eth_interface_params& eth_interface_params;
+    const tt_driver_host_address_params& host_address_params;
+    const tt_driver_noc_params& noc_params;
+    const TransferProfile& transfer_profile;
+};
+
+}  // namespace tt::umd
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace boost::interprocess {
+class mapped_region;
+}  // namespace boost::interprocess
+
+namespace tt::umd {
+
+/**
+ * 64-bit FNV-1a hash of a sequence of configuration values, used to tell whether two processes configure a device in
+ * the same way. The order in which values are added matters.
+ */
+class ConfigFingerprint {
+public:
+    ConfigFingerprint& add(std::uint64_t value);
+    ConfigFingerprint& add(const std::string& value);
+
+    std::uint64_t get() const { return hash; }
+
+private:
+    std::uint64_t hash = 14695981039346656037ULL;
+};
+
+struct SessionRecordData;
+
+/**
+ * Shared memory record of the configuration the processes using a PCI device left it in. A process which finds the
+ * device closed cleanly by the last process using it, configured with the same fingerprint, can skip the
+ * initialization steps whose effect is still in place, see Cluster::start_device.
+ */
+class SessionRecord {
+public:
+    static constexpr std::size_t MAX_PROCESSES = 64;
+
+    // Opens the record of the device, creating it if it does not exist yet.
+    explicit SessionRecord(int pci_interface_id);
+    // Ends the session without a clean shutdown, if it was not ended yet.
+    ~SessionRecord();
+
+    static std::string get_shared_memory_name(int pci_interface_id);
+    static void remove(int pci_interface_id);
+
+    /**
+     * Register this process as using the device. Returns whether the device can be resumed: the last process using it
+     * configured it with fingerprint and shut down cleanly, and no other process is using it now.
+     */
+    bool begin_session(std::uint64_t fingerprint);
+
+    // Called once the device was initialized from scratch with the configuration identified by fingerprint.
+    void record_configuration(std::uint64_t fingerprint, std::uint32_t eth_fw_version);
+
+    /**
+     * Called when the device is configured beyond what the fingerprint covers, such as iATU regions programmed for
+     * registered host memory. The configuration is not recorded any more, so the next process initializes the device
+     * again instead of resuming it.
+     */
+    void invalidate_configuration();
+
+    // Ethernet firmware version the device was initialized with.
+    std::uint32_t get_eth_fw_version() const;
+
+    /**
+     * Unregister this process. With clean_shutdown, and if no other process is using the device, its configuration is
+     * kept for the next process to resume.
+     */
+    void end_session(bool clean_shutdown);
+
+private:
+    bool other_processes_alive();
+
+    std::unique_ptr<boost::interprocess::mapped_region> region;
+    SessionRecordData* data;
+    // Slot of this process in the record, or -1 outside of a session.
+    int process_slot = -1;
+};
+
+}  // namespace tt::umd
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tt::umd {
+
+/**
+ * Contiguous range of host memory, with a 64-bit size, passed to the transfer APIs instead of a pointer and size pair.
+ * Covers the part of std::span the driver uses.
+ */
+// Replace with std::span once we enable C++20
+template <typename T>
+class Span {
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    constexpr Span() = default;
+
+    constexpr Span(T* data, std::size_t size) : data_(data), size_(size) {}
+
+    // Any contiguous container of elements convertible to T, such as std::vector or std::array.
+    template <
+        typename Container,
+        typename = std::enable_if_t<std::is_convertible_v<
+            std::remove_pointer_t<decltype(std::declval<Container&>().data())> (*)[],
+            T (*)[]>>>
+    constexpr Span(Container& container) : data_(container.data()), size_(container.size()) {}
+
+    constexpr T* data() const { return data_; }
+
+    constexpr std::size_t size() const { return size_; }
+
+    constexpr std::size_t size_bytes() const { return size_ * sizeof(T); }
+
+    constexpr bool empty() const { return size_ == 0; }
+
+    constexpr T* begin() const { return data_; }
+
+    constexpr T* end() const { return data_ + size_; }
+
+    constexpr T& operator[](std::size_t index) const { return data_[index]; }
+
+    // Elements offset to offset + count, or to the end of the span if count is npos.
+    Span subspan(std::size_t offset, std::size_t count = npos) const {
+        if (offset > size_ || (count != npos && count > size_ - offset)) {
+            throw std::out_of_range(
+                "Subspan at offset " + std::to_string(offset) + " does not fit in a span of " + std::to_string(size_) +
+                " elements.");
+        }
+        return Span(data_ + offset, count == npos ? size_ - offset : count);
+    }
+
+private:
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// Bytes of a contiguous container or span, for the byte based transfer APIs.
+template <typename Container>
+Span<const std::uint8_t> as_bytes(const Container& container) {
+    return Span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(container.data()), container.size() * sizeof(*container.data()));
+}
+
+template <typename Container>
+Span<std::uint8_t> as_writable_bytes(Container&& container) {
+    return Span<std::uint8_t>(
+        reinterpret_cast<std::uint8_t*>(container.data()), container.size() * sizeof(*container.data()));
+}
+
+/**
+ * Host buffers, such as the pages or shards of a tensor, transferred as one contiguous range of device memory. The
+ * transfers walk the buffers in place, without concatenating them into a temporary buffer first.
+ * The list does not own the buffers, nor the vector of segments it is built from.
+ */
+template <typename T>
+class SegmentList {
+public:
+    explicit SegmentList(Span<T> segment) :
+        single_segment(segment), segments(&single_segment), size(segment.size()) {}
+
+    explicit SegmentList(const std::vector<Span<T>>& segments) : segments(segments.data()) {
+        for (const Span<T>& segment : segments) {
+            size += segment.size();
+        }
+    }
+
+    // Refers to its own single segment.
+    SegmentList(const SegmentList&) = delete;
+    SegmentList& operator=(const SegmentList&) = delete;
+
+    std::uint64_t size_bytes() const { return size; }
+
+    /**
+     * Call function(piece, piece_offset) for the parts of the segments which hold range_size bytes at range_offset of
+     * the range, in order. piece_offset is the offset of the piece from range_offset. The list remembers the segment
+     * the last piece was in, so transfers which visit the range in order do not search the segments again.
+     */
+    template <typename Function>
+    void for_each_piece(std::uint64_t range_offset, std::uint64_t range_size, Function&& function) {
+        if (range_offset + range_size > size) {
+            throw std::out_of_range(
+                "Range of " + std::to_string(range_size) + " bytes at offset " + std::to_string(range_offset) +
+                " does not fit in segments of " + std::to_string(size) + " bytes.");
+        }
+        if (range_offset < current_segment_start) {
+            current_segment = 0;
+            current_segment_start = 0;
+        }
+        std::uint64_t piece_offset = 0;
+        while (piece_offset < range_size) {
+            const std::uint64_t offset = range_offset + piece_offset;
+            while (current_segment_start + segments[current_segment].size() <= offset) {
+                current_segment_start += segments[current_segment].size();
+                current_segment++;
+            }
+            const std::uint64_t segment_offset = offset - current_segment_start;
+            const std::uint64_t piece_size =
+                std::min<std::uint64_t>(segments[current_segment].size() - segment_offset, range_size - piece_offset);
+            function(segments[current_segment].subspan(segment_offset, piece_size), piece_offset);
+            piece_offset += piece_size;
+        }
+    }
+
+private:
+    Span<T> single_segment;
+    const Span<T>* segments = nullptr;
+    std::uint64_t size = 0;
+    std::size_t current_segment = 0;
+    std::uint64_t current_segment_start = 0;
+};
+
+}  // namespace tt::umd
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+class PCIDevice;
+
+namespace tt::umd {
+
+/**
+ * Transfer settings which depend on the host the cluster is attached to (CPU, PCIe link, NUMA placement) rather than
+ * on the devices themselves. The defaults are the settings UMD always used, Cluster::calibrate_transfers measures the
+ * ones which suit the current host best. Profiles are kept in a file shared by many hosts, each one under the
+ * description of the host it was measured on, see get_host_description.
+ */
+struct TransferProfile {
+    // Remote writes larger than this are staged in host memory instead of the L1 buffers of the ethernet core.
+    std::uint32_t remote_write_dram_threshold = 1024;
+    // Remote reads larger than this are returned through host memory instead of the L1 buffers of the ethernet core.
+    std::uint32_t remote_read_dram_threshold = 1024;
+    // Size of the blocks remote transfers staged in host memory are split into, 0 for the largest block the host
+    // memory layout allows.
+    std::uint32_t remote_dram_block_size = 0;
+    // Reads from write-combined device mappings of at least this size use wide streaming loads.
+    std::size_t streaming_read_min_size = 128;
+
+    // Description of the host the profile was measured on, see get_host_description.
+    std::string host;
+
+    bool operator==(const TransferProfile& other) const;
+
+    /**
+     * Description of the host: CPU model, and architecture, PCIe link and NUMA node of every device. Hosts with the
+     * same description can share a profile.
+     */
+    static std::string get_host_description(const std::vector<const PCIDevice*>& devices);
+
+    /**
+     * Profile file from TT_UMD_TRANSFER_PROFILE, or ~/.cache/tt-umd/transfer_profile.yaml by default.
+     */
+    static std::string get_default_path();
+
+    /**
+     * Profile measured on a host with the given description, or nullopt if the file does not exist or has no such
+     * profile. Throws if the file cannot be parsed.
+     */
+    static std::optional<TransferProfile> load(const std::string& path, const std::string& host);
+
+    /**
+     * Store the profile in the file, replacing the one of the same host. Profiles of other hosts are kept.
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * Index of the first size from which the alternative way of transferring is faster than the baseline for every
+     * larger size as well, or nullopt if it is not faster for the largest size. Sizes are in increasing order, and
+     * the times are measured for each of them.
+     */
+    static std::optional<std::size_t> find_crossover(
+        const std::vector<double>& baseline_times, const std::vector<double>& alternative_times);
+};
+
+}  // namespace tt::umd
@@ -34,6 +34,9 @@ enum BoardType : uint32_t {
 };
 
 class tt_ClusterDescriptor {
+    // Gives tests and benchmarks access to the internal state, e.g. to clear the lookup caches.
+    friend class tt_ClusterDescriptorTestAccess;
+
 private:
     tt_ClusterDescriptor() = default;
 
@@ -43,6 +46,8 @@ protected:
     std::unordered_map<chip_id_t, std::unordered_map<ethernet_channel_t, std::tuple<chip_id_t, ethernet_channel_t>>>
         ethernet_connections;
     std::unordered_map<chip_id_t, eth_coord_t> chip_locations;
+    // chip_locations filtered by enabled_active_chips, filled by enable_all_devices.
+    std::unordered_map<chip_id_t, eth_coord_t> enabled_chip_locations;
     // reverse map: rack/shelf/y/x -> chip_id
     std::map<int, std::map<int, std::map<int, std::map<int, chip_id_t>>>> coords_to_chip_ids;
     std::unordered_map<chip_id_t, chip_id_t> chips_with_mmio;
@@ -51,6 +56,7 @@ protected:
     std::unordered_map<chip_id_t, std::uint32_t> harvesting_masks = {};
     std::unordered_set<chip_id_t> enabled_active_chips;
     std::unordered_map<chip_id_t, chip_id_t> closest_mmio_chip_cache = {};
+    std::unordered_map<chip_id_t, std::vector<std::pair<chip_id_t, int>>> mmio_capable_chips_by_distance_cache = {};
     std::unordered_map<chip_id_t, BoardType> chip_board_type = {};
     std::unordered_map<chip_id_t, std::unordered_set<chip_id_t>> chips_grouped_by_closest_mmio;
 
@@ -89,6 +95,11 @@ public:
     bool is_chip_mmio_capable(const chip_id_t chip_id) const;
     bool is_chip_remote(const chip_id_t chip_id) const;
     chip_id_t get_closest_mmio_capable_chip(const chip_id_t chip);
+    /*
+     * Returns the MMIO capable chips which are connected to the chip through ethernet links, together with their
+     * ethernet link distance to the chip, sorted from the closest one.
+     */
+    const std::vector<std::pair<chip_id_t, int>> &get_mmio_capable_chips_by_distance(const chip_id_t chip);
     chip_id_t get_shelf_local_physical_chip_coords(chip_id_t virtual_coord);
 
     // TODO: These following functions will be removed, and ClusterDescriptor will be created without any parameters.
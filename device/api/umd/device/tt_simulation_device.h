@@ -42,12 +42,10 @@ public:
 
     virtual void wait_for_non_mmio_flush();
     virtual void wait_for_non_mmio_flush(const chip_id_t chip);
-    void l1_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {});
+    void l1_membar(const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {});
     void dram_membar(
         const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<uint32_t>& channels);
-    void dram_membar(
-        const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores = {});
+    void dram_membar(const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {});
 
     // Misc. Functions to Query/Set Device State
     // virtual bool using_harvested_soc_descriptors();
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -103,7 +104,7 @@ public:
     std::vector<std::size_t> trisc_sizes;  // Most of software stack assumes same trisc size for whole chip..
     std::string device_descriptor_file_path = std::string("");
 
-    bool has(tt_xy_pair input) { return cores.find(input) != cores.end(); }
+    bool has(tt_xy_pair input) const;
 
     int overlay_version;
     int unpacker_version;
@@ -118,6 +119,20 @@ public:
     bool is_worker_core(const tt_xy_pair &core) const;
     tt_xy_pair get_core_for_dram_channel(int dram_chan, int subchannel) const;
     bool is_ethernet_core(const tt_xy_pair &core) const;
+    // Throws std::out_of_range for cores which are not part of the descriptor.
+    CoreType get_core_type(const tt_xy_pair &core) const;
+    // Throws std::out_of_range for cores which are not ethernet cores.
+    int get_ethernet_channel(const tt_xy_pair &core) const;
+    // Throws std::out_of_range for cores which are not DRAM cores.
+    int get_dram_channel(const tt_xy_pair &core) const;
+
+    /**
+     * Rebuilds the dense, grid indexed lookup tables behind has, is_worker_core and is_ethernet_core from the keys of
+     * cores, the routing maps and the channel maps. The lookups rebuild them as well once the number of entries of any
+     * of these maps changed, so this only has to be called after replacing keys one for one. The first lookup after
+     * such a change must not run concurrently with other lookups on the descriptor.
+     */
+    void build_core_tables() const;
 
     // Default constructor. Creates uninitialized object with public access to all of its attributes.
     tt_SocDescriptor() = default;
@@ -156,6 +171,11 @@ public:
         eth_l1_size(other.eth_l1_size),
         noc_translation_id_enabled(other.noc_translation_id_enabled),
         dram_bank_size(other.dram_bank_size),
+        core_table_sources(other.core_table_sources),
+        core_table_size(other.core_table_size),
+        core_table(other.core_table),
+        routing_x_to_worker_x_table(other.routing_x_to_worker_x_table),
+        routing_y_to_worker_y_table(other.routing_y_to_worker_y_table),
         coordinate_manager(other.coordinate_manager) {}
 
     // CoreCoord conversions.
@@ -167,6 +187,28 @@ private:
     void create_coordinate_manager(const std::size_t tensix_harvesting_mask, const std::size_t dram_harvesting_mask);
     void load_core_descriptors_from_device_descriptor(YAML::Node &device_descriptor_yaml);
     void load_soc_features_from_device_descriptor(YAML::Node &device_descriptor_yaml);
+    // Number of entries of cores, the channel maps and the routing maps.
+    std::array<std::size_t, 5> get_core_table_sources() const;
+    // Rebuilds the core tables if the maps they are built from changed size since they were built, for example for a
+    // default constructed descriptor filled in by hand.
+    void update_core_tables() const;
+    // Index into the core tables, or -1 for cores outside of the tables.
+    int core_table_index(const tt_xy_pair &core) const;
+
+    // Flags of core_table entries.
+    static constexpr std::uint8_t IN_DESCRIPTOR = 1 << 0;
+    static constexpr std::uint8_t ETHERNET_CORE = 1 << 1;
+
+    // The tables only keep which cores are in the maps, the values are looked up in the maps themselves, so that
+    // changing them in place does not leave the tables stale.
+    // Sizes of the maps the tables were built from, see get_core_table_sources.
+    mutable std::array<std::size_t, 5> core_table_sources = {};
+    // Flags of the cores, row major over core_table_size.
+    mutable tt_xy_pair core_table_size = {0, 0};
+    mutable std::vector<std::uint8_t> core_table = {};
+    // Whether routing_x_to_worker_x and routing_y_to_worker_y have an entry, indexed by routing coordinate.
+    mutable std::vector<bool> routing_x_to_worker_x_table = {};
+    mutable std::vector<bool> routing_y_to_worker_y_table = {};
 
     // TODO: change this to unique pointer as soon as copying of tt_SocDescriptor
     // is not needed anymore. Soc descriptor and coordinate manager should be
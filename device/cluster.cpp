@@ -11,8 +11,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/interprocess/permissions.hpp>
 #include <boost/interprocess/sync/named_mutex.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
@@ -23,6 +25,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -59,6 +62,13 @@ const uint64_t BH_4GB_TLB_SIZE = 4ULL * 1024 * 1024 * 1024;
 // Remove 256MB from full 1GB for channel 3 (iATU limitation)
 static constexpr uint32_t HUGEPAGE_CHANNEL_3_SIZE_LIMIT = 805306368;
 
+// Size of the host memory windows of the PCIe address space seen by the device, one per hugepage channel.
+static constexpr uint32_t HOST_MEMORY_WINDOW_SIZE = 1 << 30;
+
+// Smallest iATU region, and number of outbound iATU regions of the PCIe controller.
+static constexpr uint32_t IATU_REGION_GRANULE = 64 * 1024;
+static constexpr uint32_t NUM_IATU_REGIONS = 16;
+
 // TODO: Remove in favor of cluster descriptor method, when it becomes available.
 // Metal uses this function to determine the architecture of the first PCIe chip
 // and then verifies that all subsequent chips are of the same architecture.  It
@@ -92,15 +102,6 @@ tt::ARCH detect_arch() {
     return devices_info.begin()->second.get_arch();
 }
 
-template <typename T>
-void size_buffer_to_capacity(std::vector<T>& data_buf, std::size_t size_in_bytes) {
-    std::size_t target_size = 0;
-    if (size_in_bytes > 0) {
-        target_size = ((size_in_bytes - 1) / sizeof(T)) + 1;
-    }
-    data_buf.resize(target_size);
-}
-
 // TODO: To be removed when tt_device is removed
 
 tt_device::tt_device() : soc_descriptor_per_chip({}) {}
@@ -122,24 +123,6 @@ const tt_SocDescriptor& tt_device::get_soc_descriptor(chip_id_t chip_id) const {
 #include "umd/device/tt_silicon_driver_common.hpp"
 #include "umd/device/tt_xy_pair.h"
 
-struct routing_cmd_t {
-    uint64_t sys_addr;
-    uint32_t data;
-    uint32_t flags;
-    uint16_t rack;
-    uint16_t src_resp_buf_index;
-    uint32_t local_buf_index;
-    uint8_t src_resp_q_id;
-    uint8_t host_mem_txn_id;
-    uint16_t padding;
-    uint32_t src_addr_tag;  // upper 32-bits of request source address.
-};
-
-struct remote_update_ptr_t {
-    uint32_t ptr;
-    uint32_t pad[3];
-};
-
 namespace {
 struct tt_4_byte_aligned_buffer {
     // Stores a 4 byte aligned buffer
@@ -166,12 +149,30 @@ struct tt_4_byte_aligned_buffer {
         }
     }
 };
+
+// Median time of repeated runs of transfer, in nanoseconds. The first run is not counted, it pays for programming
+// TLBs and faulting in buffers.
+double measure_transfer_time(const std::function<void()>& transfer) {
+    constexpr int NUM_RUNS = 15;
+    transfer();
+    std::vector<double> times = {};
+    for (int i = 0; i < NUM_RUNS; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        transfer();
+        times.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+// Gateway assignments of remote chips locked by the transfers of this thread, with the number of locks on each.
+thread_local std::unordered_map<const void*, int> gateway_assignments_locked_by_thread = {};
 }  // namespace
 
 namespace tt::umd {
 
 bool Cluster::address_in_tlb_space(
-    uint64_t address, uint32_t size_in_bytes, int32_t tlb_index, uint64_t tlb_size, std::uint32_t chip) {
+    uint64_t address, uint64_t size_in_bytes, int32_t tlb_index, uint64_t tlb_size, std::uint32_t chip) {
     const auto& tlb_map = tlb_config_map.at(chip);
     const auto it = tlb_map.find(tlb_index);
     if (it != tlb_map.end()) {
@@ -197,14 +198,26 @@ void Cluster::initialize_interprocess_mutexes(int pci_interface_id, bool cleanup
     unrestricted_permissions.set_unrestricted();
     std::string mutex_name = "";
 
+    if (cleanup_mutexes_in_shm) {
+        LockStatsTable::remove(pci_interface_id);
+        SessionRecord::remove(pci_interface_id);
+    }
+    auto& lock_stats_table = lock_stats_tables[pci_interface_id];
+    lock_stats_table = std::make_unique<LockStatsTable>(pci_interface_id);
+    session_records[pci_interface_id] = std::make_unique<SessionRecord>(pci_interface_id);
+    auto create_mutex = [&](const std::string& name) {
+        return std::make_shared<ProfiledNamedMutex>(
+            std::make_unique<named_mutex>(open_or_create, name.c_str(), unrestricted_permissions),
+            lock_stats_table->get_slot(name));
+    };
+
     // Initialize Dynamic TLB mutexes
     for (auto& tlb : dynamic_tlb_config) {
         mutex_name = tlb.first + std::to_string(pci_interface_id);
         if (cleanup_mutexes_in_shm) {
             named_mutex::remove(mutex_name.c_str());
         }
-        hardware_resource_mutex_map[mutex_name] =
-            std::make_shared<named_mutex>(open_or_create, mutex_name.c_str(), unrestricted_permissions);
+        hardware_resource_mutex_map[mutex_name] = create_mutex(mutex_name);
     }
 
     // Initialize ARC core mutex
@@ -212,8 +225,7 @@ void Cluster::initialize_interprocess_mutexes(int pci_interface_id, bool cleanup
     if (cleanup_mutexes_in_shm) {
         named_mutex::remove(mutex_name.c_str());
     }
-    hardware_resource_mutex_map[mutex_name] =
-        std::make_shared<named_mutex>(open_or_create, mutex_name.c_str(), unrestricted_permissions);
+    hardware_resource_mutex_map[mutex_name] = create_mutex(mutex_name);
 
     if (arch_name == tt::ARCH::WORMHOLE_B0) {
         mutex_name = NON_MMIO_MUTEX_NAME + std::to_string(pci_interface_id);
@@ -222,8 +234,7 @@ void Cluster::initialize_interprocess_mutexes(int pci_interface_id, bool cleanup
         if (cleanup_mutexes_in_shm) {
             named_mutex::remove(mutex_name.c_str());
         }
-        hardware_resource_mutex_map[mutex_name] =
-            std::make_shared<named_mutex>(open_or_create, mutex_name.c_str(), unrestricted_permissions);
+        hardware_resource_mutex_map[mutex_name] = create_mutex(mutex_name);
     }
 
     // Initialize interprocess mutexes to make host -> device memory barriers atomic
@@ -231,8 +242,7 @@ void Cluster::initialize_interprocess_mutexes(int pci_interface_id, bool cleanup
     if (cleanup_mutexes_in_shm) {
         named_mutex::remove(mutex_name.c_str());
     }
-    hardware_resource_mutex_map[mutex_name] =
-        std::make_shared<named_mutex>(open_or_create, mutex_name.c_str(), unrestricted_permissions);
+    hardware_resource_mutex_map[mutex_name] = create_mutex(mutex_name);
 
     // Restore old mask
     umask(old_umask);
@@ -255,6 +265,8 @@ void Cluster::create_device(
     log_assert(
         target_mmio_device_ids.size() > 0, "Must provide set of target_mmio_device_ids to Cluster constructor now.");
 
+    std::map<chip_id_t, int> num_host_mem_channels_per_device;
+
     for (const chip_id_t& logical_device_id : target_mmio_device_ids) {
         log_assert(
             logical_to_physical_device_id_map.count(logical_device_id) != 0,
@@ -268,6 +280,7 @@ void Cluster::create_device(
                 "Opening TT_PCI_INTERFACE_ID {} for netlist target_device_id: {}",
                 pci_interface_id,
                 logical_device_id);
+            auto phase = startup_profiler.measure(fmt::format("Open PCI device {}", pci_interface_id));
             m_pci_device_map.insert({logical_device_id, std::make_unique<PCIDevice>(pci_interface_id)});
         }
         auto dev = m_pci_device_map.at(logical_device_id).get();
@@ -295,7 +308,10 @@ void Cluster::create_device(
             pci_device->get_device_num(),
             pci_device->revision_id);
 
-        initialize_interprocess_mutexes(pci_interface_id, clean_system_resources);
+        {
+            auto phase = startup_profiler.measure("Interprocess mutexes");
+            initialize_interprocess_mutexes(pci_interface_id, clean_system_resources);
+        }
 
         // MT: Initial BH - hugepages will fail init
         // For using silicon driver without workload to query mission mode params, no need for hugepage.
@@ -305,10 +321,29 @@ void Cluster::create_device(
                 !(arch_name == tt::ARCH::BLACKHOLE && num_host_mem_channels > 1),
                 "More channels are not yet supported for Blackhole");
             // Same number of host channels per device for now
-            bool hugepages_initialized = m_pci_device_map.at(logical_device_id)->init_hugepage(num_host_mem_channels);
+            num_host_mem_channels_per_device[logical_device_id] = num_host_mem_channels;
+        }
+        // translation layer for harvested coords. Default is identity map
+        set_harvested_coord_translation(logical_device_id, create_harvested_coord_translation(arch_name, true));
+    }
+
+    if (!num_host_mem_channels_per_device.empty()) {
+        // Populating and pinning hugepages takes most of the time spent opening devices, and is independent between
+        // devices, so it runs for all of them in parallel.
+        auto phase = startup_profiler.measure("Hugepages");
+        std::map<chip_id_t, std::future<bool>> hugepages_initialized;
+        for (const auto& [logical_device_id, num_host_mem_channels] : num_host_mem_channels_per_device) {
+            PCIDevice* pci_device = m_pci_device_map.at(logical_device_id).get();
+            hugepages_initialized[logical_device_id] =
+                std::async(std::launch::async, [pci_device, num_host_mem_channels = num_host_mem_channels] {
+                    return pci_device->init_hugepage(num_host_mem_channels);
+                });
+        }
+        for (auto& [logical_device_id, initialized] : hugepages_initialized) {
             // Large writes to remote chips require hugepages to be initialized.
             // Conservative assert - end workload if remote chips present but hugepages not initialized (failures caused
             // if using remote only for small transactions)
+            const bool hugepages_initialized = initialized.get();
             if (target_remote_chips.size()) {
                 log_assert(
                     hugepages_initialized,
@@ -318,23 +353,41 @@ void Cluster::create_device(
                 log_warning(LogSiliconDriver, "No hugepage mapping at device {}.", logical_device_id);
             }
         }
-        // translation layer for harvested coords. Default is identity map
-        harvested_coord_translation.insert({logical_device_id, create_harvested_coord_translation(arch_name, true)});
     }
 
     for (const chip_id_t& chip : target_devices_in_cluster) {
         // Initialize identity mapping for Non-MMIO chips as well
         if (!cluster_desc->is_chip_mmio_capable(chip)) {
-            harvested_coord_translation.insert({chip, create_harvested_coord_translation(arch_name, true)});
-            flush_non_mmio_per_chip[chip] = false;
+            set_harvested_coord_translation(chip, create_harvested_coord_translation(arch_name, true));
+            eth_cores_to_flush_per_remote_chip.try_emplace(chip);
+            remote_transfer_gateway_per_chip[chip].mmio_chip = cluster_desc->get_closest_mmio_capable_chip(chip);
         }
     }
+
+    // Transfers only look up the per-chip state created here, so threads driving different chips never insert into
+    // the maps they share.
+    for (const auto& [mmio_chip, dev] : m_pci_device_map) {
+        all_target_mmio_devices.insert(mmio_chip);
+        flush_non_mmio_per_chip.try_emplace(mmio_chip);
+        active_core_per_chip[mmio_chip] = NON_EPOCH_ETH_CORES_START_ID;
+        pending_posted_writes_per_chip.try_emplace(mmio_chip);
+    }
 }
 
 bool Cluster::using_harvested_soc_descriptors() { return perform_harvesting_on_sdesc && performed_harvesting; }
 
 std::unordered_map<tt_xy_pair, tt_xy_pair> Cluster::get_harvested_coord_translation_map(chip_id_t logical_device_id) {
-    return harvested_coord_translation.at(logical_device_id);
+    return harvested_coord_translation.at(logical_device_id).to_map();
+}
+
+void Cluster::set_harvested_coord_translation(
+    chip_id_t logical_device_id, const std::unordered_map<tt_xy_pair, tt_xy_pair>& translation) {
+    if (harvested_coord_translation.size() <= static_cast<std::size_t>(logical_device_id)) {
+        harvested_coord_translation.resize(logical_device_id + 1);
+    }
+    // Blackhole firmware always enables NOC translation, Wormhole only when its translation tables are set up.
+    const bool noc_translation_enabled = arch_name == tt::ARCH::BLACKHOLE || translation_tables_en;
+    harvested_coord_translation[logical_device_id] = CoordTranslationTable(translation, noc_translation_enabled);
 }
 
 std::unordered_map<chip_id_t, uint32_t> Cluster::get_harvesting_masks_for_soc_descriptors() {
@@ -355,6 +408,11 @@ void Cluster::construct_cluster(
     const bool clean_system_resources,
     bool perform_harvesting,
     std::unordered_map<chip_id_t, uint32_t> simulated_harvesting_masks) {
+    const char* trace_file_path = std::getenv("TT_UMD_TRACE_FILE");
+    if (trace_file_path != nullptr && !DriverTrace::is_enabled()) {
+        enable_tracing(trace_file_path);
+    }
+
     std::unordered_set<chip_id_t> target_mmio_device_ids;
     for (auto& d : target_devices_in_cluster) {
         log_assert(
@@ -380,7 +438,11 @@ void Cluster::construct_cluster(
     for (const auto& tlb : dynamic_tlb_config) {
         dynamic_tlb_ordering_modes.insert({tlb.first, TLB_DATA::Relaxed});
     }
-    create_device(target_mmio_device_ids, num_host_mem_ch_per_mmio_device, skip_driver_allocs, clean_system_resources);
+    {
+        auto phase = startup_profiler.measure("Open devices");
+        create_device(
+            target_mmio_device_ids, num_host_mem_ch_per_mmio_device, skip_driver_allocs, clean_system_resources);
+    }
 
     // MT: Initial BH - Disable dependency to ethernet firmware
     if (arch_name == tt::ARCH::BLACKHOLE) {
@@ -389,6 +451,7 @@ void Cluster::construct_cluster(
         use_virtual_coords_for_eth_broadcast = false;
     }
 
+    const std::size_t harvesting_phase = startup_profiler.begin("Harvesting");
     if (arch_name == tt::ARCH::WORMHOLE_B0) {
         const auto& harvesting_masks = cluster_desc->get_harvesting_info();
         const auto& noc_translation_enabled = cluster_desc->get_noc_translation_table_en();
@@ -420,9 +483,8 @@ void Cluster::construct_cluster(
         }
 
         if (translation_tables_en) {
-            harvested_coord_translation.clear();
             for (const chip_id_t& chip : target_devices_in_cluster) {
-                harvested_coord_translation.insert({chip, create_harvested_coord_translation(arch_name, false)});
+                set_harvested_coord_translation(chip, create_harvested_coord_translation(arch_name, false));
             }
         }
         log_assert(
@@ -488,19 +550,27 @@ void Cluster::construct_cluster(
         }
     }
 
-    perform_harvesting_and_populate_soc_descriptors(sdesc_path, perform_harvesting);
-    populate_cores();
+    startup_profiler.end(harvesting_phase);
 
-    // MT: Initial BH - skip this for BH
-    if (arch_name == tt::ARCH::WORMHOLE_B0) {
+    {
+        auto phase = startup_profiler.measure("SoC descriptors");
+        perform_harvesting_and_populate_soc_descriptors(sdesc_path, perform_harvesting);
+        populate_cores();
+    }
+
+    if (arch_name == tt::ARCH::WORMHOLE_B0 || arch_name == tt::ARCH::BLACKHOLE) {
         remote_transfer_ethernet_cores.resize(target_mmio_device_ids.size());
         for (const auto& logical_mmio_chip_id : target_mmio_device_ids) {
             const tt_SocDescriptor& soc_desc = get_soc_descriptor(logical_mmio_chip_id);
+            if (remote_transfer_ethernet_cores.size() <= logical_mmio_chip_id) {
+                remote_transfer_ethernet_cores.resize(logical_mmio_chip_id + 1);
+            }
+            // Blackhole SoC descriptors without ethernet cores leave the chip without remote transfers.
+            if (soc_desc.ethernet_cores.size() < NUM_ETH_CORES_FOR_NON_MMIO_TRANSFERS) {
+                continue;
+            }
             // 4-5 is for send_epoch_commands, 0-3 are for everything else
             for (std::uint32_t i = 0; i < NUM_ETH_CORES_FOR_NON_MMIO_TRANSFERS; i++) {
-                if (remote_transfer_ethernet_cores.size() <= logical_mmio_chip_id) {
-                    remote_transfer_ethernet_cores.resize(logical_mmio_chip_id + 1);
-                }
                 remote_transfer_ethernet_cores.at(logical_mmio_chip_id)
                     .push_back(tt_cxy_pair(
                         logical_mmio_chip_id, soc_desc.ethernet_cores.at(i).x, soc_desc.ethernet_cores.at(i).y));
@@ -516,6 +586,13 @@ void Cluster::construct_cluster(
 
     // Default initialize noc_params based on detected arch
     noc_params = architecture_implementation->get_noc_params();
+
+    {
+        auto phase = startup_profiler.measure("Transfer profile");
+        load_transfer_profile();
+    }
+
+    log_startup_phases("Cluster construction");
 }
 
 Cluster::Cluster(
@@ -525,7 +602,10 @@ Cluster::Cluster(
     bool perform_harvesting,
     std::unordered_map<chip_id_t, uint32_t> simulated_harvesting_masks) :
     tt_device() {
-    cluster_desc = tt_ClusterDescriptor::create();
+    {
+        auto phase = startup_profiler.measure("Cluster descriptor");
+        cluster_desc = tt_ClusterDescriptor::create();
+    }
 
     // TODO: this should be fetched through ClusterDescriptor
     auto available_device_ids = detect_available_device_ids();
@@ -573,7 +653,10 @@ Cluster::Cluster(
     bool perform_harvesting,
     std::unordered_map<chip_id_t, uint32_t> simulated_harvesting_masks) :
     tt_device() {
-    cluster_desc = tt_ClusterDescriptor::create();
+    {
+        auto phase = startup_profiler.measure("Cluster descriptor");
+        cluster_desc = tt_ClusterDescriptor::create();
+    }
 
     // TODO: this should be fetched through ClusterDescriptor
     auto available_device_ids = detect_available_device_ids();
@@ -618,7 +701,10 @@ Cluster::Cluster(
     bool perform_harvesting,
     std::unordered_map<chip_id_t, uint32_t> simulated_harvesting_masks) :
     tt_device() {
-    cluster_desc = tt_ClusterDescriptor::create();
+    {
+        auto phase = startup_profiler.measure("Cluster descriptor");
+        cluster_desc = tt_ClusterDescriptor::create();
+    }
 
     // TODO: this should be fetched through ClusterDescriptor
     auto available_device_ids = detect_available_device_ids();
@@ -678,11 +764,9 @@ void Cluster::configure_active_ethernet_cores_for_mmio_device(
 void Cluster::populate_cores() {
     std::uint32_t count = 0;
     for (const auto chip : soc_descriptor_per_chip) {
-        workers_per_chip.insert(
-            {chip.first, std::unordered_set<tt_xy_pair>(chip.second.workers.begin(), chip.second.workers.end())});
+        workers_per_chip.insert({chip.first, CoreSet(chip.second.workers)});
         if (count == 0) {
-            eth_cores =
-                std::unordered_set<tt_xy_pair>(chip.second.ethernet_cores.begin(), chip.second.ethernet_cores.end());
+            eth_cores = CoreSet(chip.second.ethernet_cores);
             for (std::uint32_t dram_idx = 0; dram_idx < chip.second.get_num_dram_channels(); dram_idx++) {
                 dram_cores.insert(chip.second.get_core_for_dram_channel(dram_idx, 0));
             }
@@ -745,6 +829,7 @@ void Cluster::remove_worker_row_from_descriptor(
         full_soc_descriptor.worker_log_to_routing_y.insert({logical_y_coord, y_coord});
         logical_y_coord++;
     }
+    full_soc_descriptor.build_core_tables();
 }
 
 void Cluster::harvest_rows_in_soc_descriptor(tt::ARCH arch, tt_SocDescriptor& sdesc, uint32_t harvested_rows) {
@@ -921,7 +1006,7 @@ std::unordered_map<tt_xy_pair, tt_xy_pair> Cluster::create_harvested_coord_trans
 }
 
 void Cluster::translate_to_noc_table_coords(chip_id_t device_id, std::size_t& r, std::size_t& c) {
-    auto translated_coords = harvested_coord_translation[device_id].at(tt_xy_pair(c, r));
+    auto translated_coords = harvested_coord_translation.at(device_id).at(tt_xy_pair(c, r));
     c = translated_coords.x;
     r = translated_coords.y;
 }
@@ -930,11 +1015,16 @@ void Cluster::initialize_pcie_devices() {
     log_debug(LogSiliconDriver, "Cluster::start");
 
     for (auto& device_it : m_pci_device_map) {
+        auto phase = startup_profiler.measure(fmt::format("Check PCI device {}", device_it.first));
         check_pcie_device_initialized(device_it.first);
     }
 
-    init_pcie_iatus();
+    {
+        auto phase = startup_profiler.measure("iATUs");
+        init_pcie_iatus();
+    }
 
+    auto phase = startup_profiler.measure("Membars");
     init_membars();
 }
 
@@ -952,15 +1042,28 @@ void Cluster::broadcast_pcie_tensix_risc_reset(chip_id_t chip_id, const TensixSo
 
     auto architecture_implementation = device->get_architecture_implementation();
 
+    pcie_tensix_risc_reset_grid(
+        chip_id,
+        tt_xy_pair(0, 0),
+        tt_xy_pair(
+            architecture_implementation->get_grid_size_x() - 1,
+            architecture_implementation->get_grid_size_y() - 1 - num_rows_harvested.at(chip_id)),
+        valid);
+}
+
+void Cluster::pcie_tensix_risc_reset_grid(
+    chip_id_t chip_id, const tt_xy_pair& start, const tt_xy_pair& end, const TensixSoftResetOptions& soft_resets) {
+    PCIDevice* device = get_pci_device(chip_id);
+    auto architecture_implementation = device->get_architecture_implementation();
+    auto valid = soft_resets & ALL_TENSIX_SOFT_RESET;
+
     // TODO: this is clumsy and difficult to read
     auto [soft_reset_reg, _] = device->set_dynamic_tlb_broadcast(
         architecture_implementation->get_reg_tlb(),
         architecture_implementation->get_tensix_soft_reset_addr(),
         harvested_coord_translation.at(chip_id),
-        tt_xy_pair(0, 0),
-        tt_xy_pair(
-            architecture_implementation->get_grid_size_x() - 1,
-            architecture_implementation->get_grid_size_y() - 1 - num_rows_harvested.at(chip_id)),
+        start,
+        end,
         TLB_DATA::Posted);
     device->write_regs(soft_reset_reg, 1, &valid);
     tt_driver_atomics::sfence();
@@ -982,14 +1085,10 @@ void Cluster::deassert_risc_reset() { broadcast_tensix_risc_reset_to_cluster(TEN
 void Cluster::deassert_risc_reset_at_core(tt_cxy_pair core, const TensixSoftResetOptions& soft_resets) {
     // Get Target Device to query soc descriptor and determine location in cluster
     std::uint32_t target_device = core.chip;
+    const tt_SocDescriptor& soc_desc = get_soc_descriptor(target_device);
     log_assert(
-        std::find(
-            get_soc_descriptor(target_device).workers.begin(), get_soc_descriptor(target_device).workers.end(), core) !=
-                get_soc_descriptor(target_device).workers.end() ||
-            std::find(
-                get_soc_descriptor(target_device).ethernet_cores.begin(),
-                get_soc_descriptor(target_device).ethernet_cores.end(),
-                core) != get_soc_descriptor(target_device).ethernet_cores.end(),
+        soc_desc.has(core) && (soc_desc.get_core_type(core) == CoreType::WORKER ||
+                               soc_desc.get_core_type(core) == CoreType::ETH),
         "Cannot deassert reset on a non-tensix or harvested core");
     bool target_is_mmio_capable = cluster_desc->is_chip_mmio_capable(target_device);
     if (target_is_mmio_capable) {
@@ -998,7 +1097,6 @@ void Cluster::deassert_risc_reset_at_core(tt_cxy_pair core, const TensixSoftRese
             "Could not find MMIO mapped device in devices connected over PCIe");
         send_tensix_risc_reset_to_core(core, soft_resets);
     } else {
-        log_assert(arch_name != tt::ARCH::BLACKHOLE, "Can't issue access to remote core in BH");
         send_remote_tensix_risc_reset_to_core(core, soft_resets);
     }
 }
@@ -1006,14 +1104,10 @@ void Cluster::deassert_risc_reset_at_core(tt_cxy_pair core, const TensixSoftRese
 void Cluster::assert_risc_reset_at_core(tt_cxy_pair core) {
     // Get Target Device to query soc descriptor and determine location in cluster
     std::uint32_t target_device = core.chip;
+    const tt_SocDescriptor& soc_desc = get_soc_descriptor(target_device);
     log_assert(
-        std::find(
-            get_soc_descriptor(target_device).workers.begin(), get_soc_descriptor(target_device).workers.end(), core) !=
-                get_soc_descriptor(target_device).workers.end() ||
-            std::find(
-                get_soc_descriptor(target_device).ethernet_cores.begin(),
-                get_soc_descriptor(target_device).ethernet_cores.end(),
-                core) != get_soc_descriptor(target_device).ethernet_cores.end(),
+        soc_desc.has(core) && (soc_desc.get_core_type(core) == CoreType::WORKER ||
+                               soc_desc.get_core_type(core) == CoreType::ETH),
         "Cannot assert reset on a non-tensix or harvested core");
     bool target_is_mmio_capable = cluster_desc->is_chip_mmio_capable(target_device);
     if (target_is_mmio_capable) {
@@ -1026,6 +1120,21 @@ void Cluster::assert_risc_reset_at_core(tt_cxy_pair core) {
     }
 }
 
+void Cluster::deassert_risc_reset_at_cores(
+    const chip_id_t chip, const CoreSet& cores, const TensixSoftResetOptions& soft_resets) {
+    log_assert(
+        cores.is_subset_of(workers_per_chip.at(chip) | eth_cores),
+        "Cannot deassert reset on a non-tensix or harvested core");
+    send_tensix_risc_reset_to_cores(chip, cores, soft_resets);
+}
+
+void Cluster::assert_risc_reset_at_cores(const chip_id_t chip, const CoreSet& cores) {
+    log_assert(
+        cores.is_subset_of(workers_per_chip.at(chip) | eth_cores),
+        "Cannot assert reset on a non-tensix or harvested core");
+    send_tensix_risc_reset_to_cores(chip, cores, TENSIX_ASSERT_SOFT_RESET);
+}
+
 // Free memory during teardown, and remove (clean/unlock) from any leftover mutexes.
 void Cluster::cleanup_shared_host_state() {
     for (auto& mutex : hardware_resource_mutex_map) {
@@ -1102,12 +1211,69 @@ tt::Writer Cluster::get_static_tlb_writer(tt_cxy_pair target) {
 
 void Cluster::write_device_memory(
     const void* mem_ptr,
-    uint32_t size_in_bytes,
+    uint64_t size_in_bytes,
     tt_cxy_pair target,
     uint64_t address,
     const std::string& fallback_tlb) {
+    write_device_memory(
+        mem_ptr, size_in_bytes, target, address, fallback_tlb, dynamic_tlb_ordering_modes.at(fallback_tlb));
+}
+
+void Cluster::write_device_memory(
+    const void* mem_ptr,
+    uint64_t size_in_bytes,
+    tt_cxy_pair target,
+    uint64_t address,
+    const std::string& fallback_tlb,
+    uint64_t fallback_ordering) {
+    SegmentList<const uint8_t> source(Span<const uint8_t>(static_cast<const uint8_t*>(mem_ptr), size_in_bytes));
+    write_device_memory(source, target, address, fallback_tlb, fallback_ordering);
+}
+
+void Cluster::write_device_memory(
+    SegmentList<const uint8_t>& source,
+    tt_cxy_pair target,
+    uint64_t address,
+    const std::string& fallback_tlb,
+    uint64_t fallback_ordering) {
     PCIDevice* dev = get_pci_device(target.chip);
-    const uint8_t* buffer_addr = static_cast<const uint8_t*>(mem_ptr);
+    const uint64_t size_in_bytes = source.size_bytes();
+    // Writes size bytes at offset of the source to bar_address, one piece of the source at a time. Bytes of a device
+    // word split between pieces are gathered on the host and written together, since the read-modify-write of a partial
+    // word could overtake the posted write of its other part. Only the first and last word of the chunk are partial.
+    const auto write_chunk = [dev, &source](uint64_t bar_address, uint64_t size, uint64_t offset) {
+        std::array<uint8_t, sizeof(uint32_t)> word;
+        // Offset in the chunk of the gathered bytes, which are followed by the next piece.
+        uint64_t word_offset = 0;
+        std::size_t word_size = 0;
+        source.for_each_piece(offset, size, [&](Span<const uint8_t> piece, uint64_t piece_offset) {
+            if (word_size > 0) {
+                const std::size_t fill = std::min<uint64_t>(
+                    piece.size(), sizeof(uint32_t) - (bar_address + piece_offset) % sizeof(uint32_t));
+                std::copy(piece.begin(), piece.begin() + fill, word.begin() + word_size);
+                word_size += fill;
+                piece = piece.subspan(fill);
+                piece_offset += fill;
+                if ((bar_address + piece_offset) % sizeof(uint32_t) != 0) {
+                    return;
+                }
+                dev->write_block(bar_address + word_offset, word_size, word.data());
+                word_size = 0;
+            }
+            // The bytes past the last word boundary wait for the next piece.
+            const std::size_t tail = std::min<uint64_t>(
+                piece.size(), (bar_address + piece_offset + piece.size()) % sizeof(uint32_t));
+            if (piece.size() > tail) {
+                dev->write_block(bar_address + piece_offset, piece.size() - tail, piece.data());
+            }
+            std::copy(piece.end() - tail, piece.end(), word.begin());
+            word_offset = piece_offset + piece.size() - tail;
+            word_size = tail;
+        });
+        if (word_size > 0) {
+            dev->write_block(bar_address + word_offset, word_size, word.data());
+        }
+    };
 
     log_debug(
         LogSiliconDriver,
@@ -1121,8 +1287,8 @@ void Cluster::write_device_memory(
 
     std::int32_t tlb_index = 0;
     std::optional<std::tuple<std::uint64_t, std::uint64_t>> tlb_data = std::nullopt;
-    if (tlbs_init_per_chip[target.chip]) {
-        tlb_index = map_core_to_tlb_per_chip[target.chip](tt_xy_pair(target.x, target.y));
+    if (auto static_tlb_index = get_static_tlb_index(target)) {
+        tlb_index = *static_tlb_index;
         tlb_data = dev->get_architecture_implementation()->describe_tlb(tlb_index);
     }
 
@@ -1132,34 +1298,52 @@ void Cluster::write_device_memory(
         if (dev->bar4_wc != nullptr && tlb_size == BH_4GB_TLB_SIZE) {
             // This is only for Blackhole. If we want to  write to DRAM (BAR4 space), we add offset
             // to which we write so write_block knows it needs to target BAR4
-            dev->write_block((tlb_offset + address % tlb_size) + BAR0_BH_SIZE, size_in_bytes, buffer_addr);
+            write_chunk((tlb_offset + address % tlb_size) + BAR0_BH_SIZE, size_in_bytes, 0);
         } else {
-            dev->write_block(tlb_offset + address % tlb_size, size_in_bytes, buffer_addr);
+            write_chunk(tlb_offset + address % tlb_size, size_in_bytes, 0);
         }
+    } else if (!dual_noc_striping_tlb.empty() && fallback_tlb != dual_noc_striping_tlb &&
+               size_in_bytes >= dual_noc_striping_min_size) {
+        dual_noc_striped_transfer(
+            dev,
+            target,
+            address,
+            size_in_bytes,
+            fallback_tlb,
+            fallback_ordering,
+            true,
+            write_chunk);
     } else {
         const auto tlb_index = dynamic_tlb_config.at(fallback_tlb);
-        const scoped_lock<named_mutex> lock(*get_mutex(fallback_tlb, dev->get_device_num()));
+        TraceScope mutex_wait("Wait for TLB mutex", TraceCategory::MutexWait, target.chip);
+        const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(fallback_tlb, dev->get_device_num()));
+        mutex_wait.end();
 
-        while (size_in_bytes > 0) {
+        uint64_t offset = 0;
+        while (offset < size_in_bytes) {
+            TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, target.chip, address + offset);
             auto [mapped_address, tlb_size] = dev->set_dynamic_tlb(
-                tlb_index,
-                target,
-                address,
-                harvested_coord_translation.at(target.chip),
-                dynamic_tlb_ordering_modes.at(fallback_tlb));
-            uint32_t transfer_size = std::min((uint64_t)size_in_bytes, tlb_size);
-            dev->write_block(mapped_address, transfer_size, buffer_addr);
+                tlb_index, target, address + offset, harvested_coord_translation.at(target.chip), fallback_ordering);
+            reprogram.end();
+            // Large windows, such as the 4GB ones on Blackhole, move multi-GB transfers in a few chunks.
+            uint64_t transfer_size = std::min(size_in_bytes - offset, tlb_size);
+            write_chunk(mapped_address, transfer_size, offset);
 
-            size_in_bytes -= transfer_size;
-            address += transfer_size;
-            buffer_addr += transfer_size;
+            offset += transfer_size;
         }
         log_debug(LogSiliconDriver, "Write done Dynamic TLB with pid={}", (long)getpid());
     }
 }
 
 void Cluster::read_device_memory(
-    void* mem_ptr, tt_cxy_pair target, uint64_t address, uint32_t size_in_bytes, const std::string& fallback_tlb) {
+    void* mem_ptr, tt_cxy_pair target, uint64_t address, uint64_t size_in_bytes, const std::string& fallback_tlb) {
+    SegmentList<uint8_t> destination(Span<uint8_t>(static_cast<uint8_t*>(mem_ptr), size_in_bytes));
+    read_device_memory(destination, target, address, fallback_tlb);
+}
+
+void Cluster::read_device_memory(
+    SegmentList<uint8_t>& destination, tt_cxy_pair target, uint64_t address, const std::string& fallback_tlb) {
+    const uint64_t size_in_bytes = destination.size_bytes();
     log_debug(
         LogSiliconDriver,
         "Cluster::read_device_memory to chip:{} {}-{} at 0x{:x} size_in_bytes: {}",
@@ -1169,13 +1353,17 @@ void Cluster::read_device_memory(
         address,
         size_in_bytes);
     PCIDevice* dev = get_pci_device(target.chip);
-
-    uint8_t* buffer_addr = static_cast<uint8_t*>(mem_ptr);
+    // Reads size bytes from bar_address to offset of the destination, one piece of the destination at a time.
+    const auto read_chunk = [dev, &destination](uint64_t bar_address, uint64_t size, uint64_t offset) {
+        destination.for_each_piece(offset, size, [dev, bar_address](Span<uint8_t> piece, uint64_t piece_offset) {
+            dev->read_block(bar_address + piece_offset, piece.size(), piece.data());
+        });
+    };
 
     std::int32_t tlb_index = 0;
     std::optional<std::tuple<std::uint64_t, std::uint64_t>> tlb_data = std::nullopt;
-    if (tlbs_init_per_chip[target.chip]) {
-        tlb_index = map_core_to_tlb_per_chip[target.chip](tt_xy_pair(target.x, target.y));
+    if (auto static_tlb_index = get_static_tlb_index(target)) {
+        tlb_index = *static_tlb_index;
         tlb_data = dev->get_architecture_implementation()->describe_tlb(tlb_index);
     }
     log_debug(LogSiliconDriver, "  tlb_index: {}, tlb_data.has_value(): {}", tlb_index, tlb_data.has_value());
@@ -1186,35 +1374,50 @@ void Cluster::read_device_memory(
         if (dev->bar4_wc != nullptr && tlb_size == BH_4GB_TLB_SIZE) {
             // This is only for Blackhole. If we want to  read from DRAM (BAR4 space), we add offset
             // from which we read so read_block knows it needs to target BAR4
-            dev->read_block((tlb_offset + address % tlb_size) + BAR0_BH_SIZE, size_in_bytes, buffer_addr);
+            read_chunk((tlb_offset + address % tlb_size) + BAR0_BH_SIZE, size_in_bytes, 0);
         } else {
-            dev->read_block(tlb_offset + address % tlb_size, size_in_bytes, buffer_addr);
+            read_chunk(tlb_offset + address % tlb_size, size_in_bytes, 0);
         }
         log_debug(LogSiliconDriver, "  read_block called with tlb_offset: {}, tlb_size: {}", tlb_offset, tlb_size);
+    } else if (!dual_noc_striping_tlb.empty() && fallback_tlb != dual_noc_striping_tlb &&
+               size_in_bytes >= dual_noc_striping_min_size) {
+        dual_noc_striped_transfer(
+            dev,
+            target,
+            address,
+            size_in_bytes,
+            fallback_tlb,
+            dynamic_tlb_ordering_modes.at(fallback_tlb),
+            false,
+            read_chunk);
     } else {
         const auto tlb_index = dynamic_tlb_config.at(fallback_tlb);
-        const scoped_lock<named_mutex> lock(*get_mutex(fallback_tlb, dev->get_device_num()));
+        TraceScope mutex_wait("Wait for TLB mutex", TraceCategory::MutexWait, target.chip);
+        const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(fallback_tlb, dev->get_device_num()));
+        mutex_wait.end();
         log_debug(LogSiliconDriver, "  dynamic tlb_index: {}", tlb_index);
-        while (size_in_bytes > 0) {
+        uint64_t offset = 0;
+        while (offset < size_in_bytes) {
+            TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, target.chip, address + offset);
             auto [mapped_address, tlb_size] = dev->set_dynamic_tlb(
                 tlb_index,
                 target,
-                address,
+                address + offset,
                 harvested_coord_translation.at(target.chip),
                 dynamic_tlb_ordering_modes.at(fallback_tlb));
-            uint32_t transfer_size = std::min((uint64_t)size_in_bytes, tlb_size);
-            dev->read_block(mapped_address, transfer_size, buffer_addr);
+            reprogram.end();
+            // Large windows, such as the 4GB ones on Blackhole, move multi-GB transfers in a few chunks.
+            uint64_t transfer_size = std::min(size_in_bytes - offset, tlb_size);
+            read_chunk(mapped_address, transfer_size, offset);
 
-            size_in_bytes -= transfer_size;
-            address += transfer_size;
-            buffer_addr += transfer_size;
+            offset += transfer_size;
         }
         log_debug(LogSiliconDriver, "Read done Dynamic TLB with pid={}", (long)getpid());
     }
 }
 
 void Cluster::read_buffer(
-    void* mem_ptr, std::uint32_t address, std::uint16_t channel, std::uint32_t size_in_bytes, chip_id_t src_device_id) {
+    void* mem_ptr, std::uint64_t address, std::uint16_t channel, std::uint64_t size_in_bytes, chip_id_t src_device_id) {
     log_assert(src_device_id != -1, "Must provide src_device_id for host_resident read/write");
     log_assert(
         m_pci_device_map.find(src_device_id) != m_pci_device_map.end(), "read_buffer: Device id is not a MMIO device");
@@ -1226,6 +1429,13 @@ void Cluster::read_buffer(
         " - Ensure sufficient number of Hugepages installed per device (1 per host mem ch, per device)",
         src_device_id,
         channel);
+    log_assert(
+        address % hugepage_map.mapping_size + size_in_bytes <= hugepage_map.mapping_size,
+        "read_buffer of {} bytes at offset {} does not fit in host channel {} of {} bytes",
+        size_in_bytes,
+        address % hugepage_map.mapping_size,
+        channel,
+        hugepage_map.mapping_size);
 
     void* user_scratchspace = static_cast<char*>(hugepage_map.mapping) + (address % hugepage_map.mapping_size);
 
@@ -1240,7 +1450,7 @@ void Cluster::read_buffer(
 }
 
 void Cluster::write_buffer(
-    const void* mem_ptr, std::uint32_t size, std::uint32_t address, std::uint16_t channel, chip_id_t src_device_id) {
+    const void* mem_ptr, std::uint64_t size, std::uint64_t address, std::uint16_t channel, chip_id_t src_device_id) {
     log_assert(
         m_pci_device_map.find(src_device_id) != m_pci_device_map.end(), "write_buffer: Device id is not a MMIO device");
 
@@ -1253,9 +1463,11 @@ void Cluster::write_buffer(
         channel);
 
     log_assert(
-        size <= hugepage_map.mapping_size,
-        "write_buffer data has larger size {} than destination buffer {}",
+        address % hugepage_map.mapping_size + size <= hugepage_map.mapping_size,
+        "write_buffer of {} bytes at offset {} does not fit in host channel {} of {} bytes",
         size,
+        address % hugepage_map.mapping_size,
+        channel,
         hugepage_map.mapping_size);
     log_debug(
         LogSiliconDriver,
@@ -1349,6 +1561,7 @@ std::map<int, int> Cluster::get_clocks() {
 Cluster::~Cluster() {
     log_debug(LogSiliconDriver, "Cluster::~Cluster");
 
+    clear_host_memory_registrations();
     cleanup_shared_host_state();
 
     m_pci_device_map.clear();
@@ -1357,14 +1570,24 @@ Cluster::~Cluster() {
     dynamic_tlb_config.clear();
     tlb_config_map.clear();
     dynamic_tlb_ordering_modes.clear();
+
+    disable_tracing();
+}
+
+std::optional<std::int32_t> Cluster::get_static_tlb_index(const tt_cxy_pair& target) const {
+    auto tlbs_init = tlbs_init_per_chip.find(target.chip);
+    if (tlbs_init == tlbs_init_per_chip.end() || !tlbs_init->second) {
+        return std::nullopt;
+    }
+    return map_core_to_tlb_per_chip.at(target.chip)(tt_xy_pair(target.x, target.y));
 }
 
 std::optional<std::tuple<uint32_t, uint32_t>> Cluster::get_tlb_data_from_target(const tt_cxy_pair& target) {
     std::int32_t tlb_index = 0;
     std::optional<std::tuple<std::uint32_t, std::uint32_t>> tlb_data;
 
-    if (tlbs_init_per_chip[target.chip]) {
-        tlb_index = map_core_to_tlb_per_chip[target.chip](tt_xy_pair(target.x, target.y));
+    if (auto static_tlb_index = get_static_tlb_index(target)) {
+        tlb_index = *static_tlb_index;
         auto architecture_implementation = tt::umd::architecture_implementation::create(arch_name);
         tlb_data = architecture_implementation->describe_tlb(tlb_index);
     }
@@ -1398,6 +1621,268 @@ void Cluster::set_fallback_tlb_ordering_mode(const std::string& fallback_tlb, ui
     dynamic_tlb_ordering_modes.at(fallback_tlb) = ordering;
 }
 
+void Cluster::enable_dual_noc_striping(const std::string& noc1_tlb, uint32_t chunk_size, uint32_t min_transfer_size) {
+    log_assert(
+        dynamic_tlb_config.find(noc1_tlb) != dynamic_tlb_config.end(),
+        "Invalid TLB specified in Cluster::enable_dual_noc_striping.");
+    log_assert(
+        chunk_size > 0 && chunk_size % sizeof(uint32_t) == 0,
+        "Dual NOC striping chunk size must be a non-zero multiple of 4 bytes.");
+    dual_noc_striping_tlb = noc1_tlb;
+    dual_noc_striping_chunk_size = chunk_size;
+    dual_noc_striping_min_size = min_transfer_size;
+}
+
+void Cluster::disable_dual_noc_striping() { dual_noc_striping_tlb = ""; }
+
+void Cluster::enable_remote_transfer_load_balancing(uint32_t max_extra_hops, uint32_t min_transfer_size) {
+    log_assert(arch_name == tt::ARCH::WORMHOLE_B0, "Remote transfer load balancing is only supported on Wormhole");
+    remote_transfer_max_extra_hops = max_extra_hops;
+    remote_transfer_load_balancing_min_size = min_transfer_size;
+    remote_transfer_load_balancing = true;
+}
+
+void Cluster::disable_remote_transfer_load_balancing() {
+    remote_transfer_load_balancing = false;
+    // Remote chips go back to their closest MMIO chip, so the queues of the ones they moved to must be flushed first.
+    for (auto& [chip, gateway] : remote_transfer_gateway_per_chip) {
+        const std::unique_lock<std::shared_mutex> lock(gateway.mutex);
+        const chip_id_t closest_mmio_chip = cluster_desc->get_closest_mmio_capable_chip(chip);
+        if (gateway.mmio_chip != closest_mmio_chip) {
+            wait_for_connected_non_mmio_flush(gateway.mmio_chip);
+            gateway.mmio_chip = closest_mmio_chip;
+        }
+    }
+}
+
+const TransferProfile& Cluster::get_transfer_profile() const { return transfer_profile; }
+
+void Cluster::set_transfer_profile(const TransferProfile& profile) {
+    log_assert(
+        profile.remote_dram_block_size % 32 == 0,
+        "Remote DRAM block size {} is not a multiple of 32 bytes",
+        profile.remote_dram_block_size);
+    log_assert(
+        profile.remote_dram_block_size <= host_address_params.eth_routing_block_size,
+        "Remote DRAM block size {} is larger than the {} byte routing buffers",
+        profile.remote_dram_block_size,
+        host_address_params.eth_routing_block_size);
+    transfer_profile = profile;
+    for (auto& [chip, pci_device] : m_pci_device_map) {
+        pci_device->set_streaming_read_min_size(profile.streaming_read_min_size);
+    }
+}
+
+std::string Cluster::get_transfer_profile_host() {
+    std::vector<const PCIDevice*> pci_devices = {};
+    for (const auto& [chip, pci_device] : m_pci_device_map) {
+        pci_devices.push_back(pci_device.get());
+    }
+    std::sort(pci_devices.begin(), pci_devices.end(), [](const PCIDevice* a, const PCIDevice* b) {
+        return a->get_device_num() < b->get_device_num();
+    });
+    return TransferProfile::get_host_description(pci_devices);
+}
+
+void Cluster::load_transfer_profile() {
+    const std::string host = get_transfer_profile_host();
+    transfer_profile.host = host;
+    const std::string path = TransferProfile::get_default_path();
+    try {
+        const std::optional<TransferProfile> profile = TransferProfile::load(path, host);
+        if (!profile.has_value()) {
+            log_debug(LogSiliconDriver, "No transfer profile for host {} in {}, using default settings.", host, path);
+            return;
+        }
+        set_transfer_profile(*profile);
+        log_info(LogSiliconDriver, "Loaded transfer profile for this host from {}", path);
+    } catch (const std::exception& e) {
+        log_warning(LogSiliconDriver, "Ignoring transfer profile: {}", e.what());
+    }
+}
+
+TransferProfile Cluster::calibrate_transfers(std::uint64_t address, const std::string& fallback_tlb) {
+    log_assert((address & 0x1F) == 0, "Transfer calibration address must be 32-byte aligned");
+    log_assert(!all_target_mmio_devices.empty(), "Transfer calibration needs an MMIO chip");
+    const TransferProfile previous_profile = transfer_profile;
+    TransferProfile profile;
+    profile.host = get_transfer_profile_host();
+
+    std::vector<std::uint8_t> buffer(TRANSFER_CALIBRATION_SIZE);
+    for (std::size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = i & 0xff;
+    }
+    // Times transfers of each size with the settings of baseline and of alternative, and returns the index of the
+    // first size from which the alternative is faster.
+    const auto find_crossover = [&](const std::vector<std::uint32_t>& sizes,
+                                    const TransferProfile& baseline,
+                                    const TransferProfile& alternative,
+                                    const std::function<void(std::uint32_t)>& transfer) {
+        std::vector<double> baseline_times = {};
+        std::vector<double> alternative_times = {};
+        for (const std::uint32_t size : sizes) {
+            set_transfer_profile(baseline);
+            baseline_times.push_back(measure_transfer_time([&] { transfer(size); }));
+            set_transfer_profile(alternative);
+            alternative_times.push_back(measure_transfer_time([&] { transfer(size); }));
+        }
+        return TransferProfile::find_crossover(baseline_times, alternative_times);
+    };
+    std::vector<std::uint32_t> sizes = {};
+    for (std::uint32_t size = 16; size <= TRANSFER_CALIBRATION_SIZE; size *= 2) {
+        sizes.push_back(size);
+    }
+
+    try {
+        // Word copy against streaming loads for reads from MMIO chips.
+        const chip_id_t mmio_chip = *all_target_mmio_devices.begin();
+        const tt_cxy_pair mmio_core(mmio_chip, get_soc_descriptor(mmio_chip).workers.at(0));
+        TransferProfile word_copy = profile;
+        word_copy.streaming_read_min_size = std::numeric_limits<std::size_t>::max();
+        TransferProfile streaming = profile;
+        streaming.streaming_read_min_size = 0;
+        const std::optional<std::size_t> streaming_crossover =
+            find_crossover(sizes, word_copy, streaming, [&](std::uint32_t size) {
+                read_from_device(buffer.data(), mmio_core, address, size, fallback_tlb);
+            });
+        profile.streaming_read_min_size =
+            streaming_crossover ? sizes[*streaming_crossover] : std::numeric_limits<std::size_t>::max();
+
+        if (!target_remote_chips.empty()) {
+            const chip_id_t remote_chip = *target_remote_chips.begin();
+            const tt_cxy_pair remote_core(remote_chip, get_soc_descriptor(remote_chip).workers.at(0));
+            const auto remote_write = [&](std::uint32_t size) {
+                write_to_device(buffer.data(), size, remote_core, address, fallback_tlb);
+                wait_for_non_mmio_flush(remote_chip);
+            };
+            const auto remote_read = [&](std::uint32_t size) {
+                read_from_device(buffer.data(), remote_core, address, size, fallback_tlb);
+            };
+
+            // Block size for transfers staged in host memory, the largest one and a few smaller ones.
+            TransferProfile host_memory = profile;
+            host_memory.remote_write_dram_threshold = 0;
+            host_memory.remote_read_dram_threshold = 0;
+            double best_time = std::numeric_limits<double>::max();
+            for (std::uint32_t block_size = host_address_params.eth_routing_block_size;
+                 block_size >= host_address_params.eth_routing_block_size / 4;
+                 block_size /= 2) {
+                host_memory.remote_dram_block_size = block_size;
+                set_transfer_profile(host_memory);
+                const double time = measure_transfer_time([&] { remote_write(TRANSFER_CALIBRATION_SIZE); }) +
+                                    measure_transfer_time([&] { remote_read(TRANSFER_CALIBRATION_SIZE); });
+                if (time < best_time) {
+                    best_time = time;
+                    profile.remote_dram_block_size = block_size;
+                }
+            }
+            if (profile.remote_dram_block_size == host_address_params.eth_routing_block_size) {
+                profile.remote_dram_block_size = 0;
+            }
+
+            // Ethernet core L1 against host memory, a size uses host memory if it is larger than the threshold.
+            host_memory.remote_dram_block_size = profile.remote_dram_block_size;
+            TransferProfile ethernet_l1 = host_memory;
+            ethernet_l1.remote_write_dram_threshold = std::numeric_limits<std::uint32_t>::max();
+            ethernet_l1.remote_read_dram_threshold = std::numeric_limits<std::uint32_t>::max();
+            const auto get_threshold = [&](std::optional<std::size_t> crossover) {
+                if (!crossover.has_value()) {
+                    return sizes.back();
+                }
+                return *crossover == 0 ? 0 : sizes[*crossover - 1];
+            };
+            profile.remote_write_dram_threshold =
+                get_threshold(find_crossover(sizes, ethernet_l1, host_memory, remote_write));
+            profile.remote_read_dram_threshold =
+                get_threshold(find_crossover(sizes, ethernet_l1, host_memory, remote_read));
+        }
+    } catch (...) {
+        set_transfer_profile(previous_profile);
+        throw;
+    }
+    set_transfer_profile(previous_profile);
+    log_info(
+        LogSiliconDriver,
+        "Calibrated transfers: remote write DRAM threshold {}, remote read DRAM threshold {}, "
+        "remote DRAM block size {}, streaming read min size {}",
+        profile.remote_write_dram_threshold,
+        profile.remote_read_dram_threshold,
+        profile.remote_dram_block_size,
+        profile.streaming_read_min_size);
+    return profile;
+}
+
+void Cluster::dual_noc_striped_transfer(
+    PCIDevice* dev,
+    tt_cxy_pair target,
+    uint64_t address,
+    uint64_t size_in_bytes,
+    const std::string& fallback_tlb,
+    uint64_t ordering,
+    bool flush_noc1_writes,
+    const std::function<void(uint64_t, uint64_t, uint64_t)>& transfer_chunk) {
+    // Always lock in the same order, so that processes striping over the same pair of TLBs cannot deadlock.
+    const std::string& first_tlb = std::min(fallback_tlb, dual_noc_striping_tlb);
+    const std::string& second_tlb = std::max(fallback_tlb, dual_noc_striping_tlb);
+    TraceScope mutex_wait("Wait for TLB mutexes", TraceCategory::MutexWait, target.chip);
+    const scoped_lock<ProfiledNamedMutex> first_lock(*get_mutex(first_tlb, dev->get_device_num()));
+    const scoped_lock<ProfiledNamedMutex> second_lock(*get_mutex(second_tlb, dev->get_device_num()));
+    mutex_wait.end();
+
+    // Index 0 is the NOC0 window, index 1 the NOC1 window, matching the noc_sel value they are programmed with.
+    const std::int32_t tlb_index[2] = {
+        dynamic_tlb_config.at(fallback_tlb), dynamic_tlb_config.at(dual_noc_striping_tlb)};
+    uint64_t mapped_address[2] = {0, 0};
+    dynamic_tlb mapped_window[2] = {{0, 0}, {0, 0}};
+    // Device address of the last word written over NOC1.
+    std::optional<uint64_t> last_noc1_word = std::nullopt;
+
+    uint64_t offset = 0;
+    uint32_t noc = 0;
+    while (offset < size_in_bytes) {
+        uint64_t chunk_address = address + offset;
+        if (chunk_address < mapped_address[noc] ||
+            chunk_address >= mapped_address[noc] + mapped_window[noc].remaining_size) {
+            TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, target.chip, chunk_address);
+            mapped_window[noc] = dev->set_dynamic_tlb(
+                tlb_index[noc], target, chunk_address, harvested_coord_translation.at(target.chip), ordering, noc);
+            mapped_address[noc] = chunk_address;
+        }
+
+        uint64_t window_offset = chunk_address - mapped_address[noc];
+        uint32_t transfer_size = std::min(
+            {(uint64_t)dual_noc_striping_chunk_size,
+             size_in_bytes - offset,
+             mapped_window[noc].remaining_size - window_offset});
+        uint64_t bar_address = mapped_window[noc].bar_offset + window_offset;
+        transfer_chunk(bar_address, transfer_size, offset);
+
+        if (noc == 1) {
+            last_noc1_word = (chunk_address + transfer_size - 1) & ~static_cast<uint64_t>(sizeof(uint32_t) - 1);
+        }
+        offset += transfer_size;
+        noc ^= 1;
+    }
+
+    if (flush_noc1_writes && last_noc1_word.has_value()) {
+        // NOC1 writes are not ordered with later traffic over NOC0. A strictly ordered read through the NOC1 TLB
+        // returns only after the writes issued through it have landed, which completes the whole striped write. The
+        // window used for the writes may be relaxed, so it is reprogrammed for the read.
+        tt_driver_atomics::sfence();
+        TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, target.chip, last_noc1_word.value());
+        const dynamic_tlb flush_window = dev->set_dynamic_tlb(
+            tlb_index[1],
+            target,
+            last_noc1_word.value(),
+            harvested_coord_translation.at(target.chip),
+            TLB_DATA::Strict,
+            1);
+        reprogram.end();
+        uint32_t readback = 0;
+        dev->read_regs(flush_window.bar_offset, 1, &readback);
+    }
+}
+
 // TT<->TT P2P support removed in favor of increased Host memory.
 // TODO: this is in the wrong place, it should be in the PCIDevice.
 void Cluster::init_pcie_iatus() {
@@ -1502,6 +1987,10 @@ uint32_t Cluster::bar_read32(int logical_device_id, uint32_t addr) {
     return data;
 }
 
+std::vector<uint32_t> Cluster::bar_batch32(int logical_device_id, const std::vector<reg_batch_op>& ops) {
+    return get_pci_device(logical_device_id)->reg_batch(ops);
+}
+
 // Returns 0 if everything was OK
 int Cluster::pcie_arc_msg(
     int logical_device_id,
@@ -1512,6 +2001,7 @@ int Cluster::pcie_arc_msg(
     int timeout,
     uint32_t* return_3,
     uint32_t* return_4) {
+    TraceScope trace("ARC message", TraceCategory::ArcMessage, logical_device_id, msg_code);
     if ((msg_code & 0xff00) != 0xaa00) {
         log_error("Malformed message. msg_code is 0x{:x} but should be 0xaa..", msg_code);
     }
@@ -1522,20 +2012,25 @@ int Cluster::pcie_arc_msg(
 
     // Exclusive access for a single process at a time. Based on physical pci interface id.
     std::string msg_type = "ARC_MSG";
-    const scoped_lock<named_mutex> lock(*get_mutex(msg_type, pci_device->get_device_num()));
+    TraceScope mutex_wait("Wait for ARC message mutex", TraceCategory::MutexWait, logical_device_id);
+    const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(msg_type, pci_device->get_device_num()));
+    mutex_wait.end();
     uint32_t fw_arg = arg0 | (arg1 << 16);
     int exit_code = 0;
 
-    bar_write32(logical_device_id, architecture_implementation->get_arc_reset_scratch_offset() + 3 * 4, fw_arg);
-    bar_write32(logical_device_id, architecture_implementation->get_arc_reset_scratch_offset() + 5 * 4, msg_code);
+    const uint32_t arc_scratch_offset = architecture_implementation->get_arc_reset_scratch_offset();
+    const uint32_t arc_misc_cntl_offset = architecture_implementation->get_arc_reset_arc_misc_cntl_offset();
 
-    uint32_t misc = bar_read32(logical_device_id, architecture_implementation->get_arc_reset_arc_misc_cntl_offset());
+    uint32_t misc = pci_device->reg_batch({
+        reg_batch_op::write(arc_scratch_offset + 3 * 4, fw_arg),
+        reg_batch_op::write(arc_scratch_offset + 5 * 4, msg_code),
+        reg_batch_op::read(arc_misc_cntl_offset),
+    })[0];
     if (misc & (1 << 16)) {
         log_error("trigger_fw_int failed on device {}", logical_device_id);
         return 1;
     } else {
-        bar_write32(
-            logical_device_id, architecture_implementation->get_arc_reset_arc_misc_cntl_offset(), misc | (1 << 16));
+        pci_device->reg_batch({reg_batch_op::write(arc_misc_cntl_offset, misc | (1 << 16))});
     }
 
     if (wait_for_done) {
@@ -1548,17 +2043,20 @@ int Cluster::pcie_arc_msg(
                     "Timed out after waiting {} seconds for device {} ARC to respond", timeout, logical_device_id));
             }
 
-            status = bar_read32(logical_device_id, architecture_implementation->get_arc_reset_scratch_offset() + 5 * 4);
+            status = bar_read32(logical_device_id, arc_scratch_offset + 5 * 4);
 
             if ((status & 0xffff) == (msg_code & 0xff)) {
-                if (return_3 != nullptr) {
-                    *return_3 = bar_read32(
-                        logical_device_id, architecture_implementation->get_arc_reset_scratch_offset() + 3 * 4);
-                }
-
-                if (return_4 != nullptr) {
-                    *return_4 = bar_read32(
-                        logical_device_id, architecture_implementation->get_arc_reset_scratch_offset() + 4 * 4);
+                if (return_3 != nullptr || return_4 != nullptr) {
+                    std::vector<uint32_t> return_values = pci_device->reg_batch({
+                        reg_batch_op::read(arc_scratch_offset + 3 * 4),
+                        reg_batch_op::read(arc_scratch_offset + 4 * 4),
+                    });
+                    if (return_3 != nullptr) {
+                        *return_3 = return_values[0];
+                    }
+                    if (return_4 != nullptr) {
+                        *return_4 = return_values[1];
+                    }
                 }
 
                 exit_code = (status & 0xffff0000) >> 16;
@@ -1646,11 +2144,13 @@ int Cluster::iatu_configure_peer_region(
             &limit_address_hi,
             1);
     } else {
-        bar_write32(
-            logical_device_id, architecture_implementation->get_arc_csm_mailbox_offset() + 0 * 4, region_id_to_use);
-        bar_write32(logical_device_id, architecture_implementation->get_arc_csm_mailbox_offset() + 1 * 4, dest_bar_lo);
-        bar_write32(logical_device_id, architecture_implementation->get_arc_csm_mailbox_offset() + 2 * 4, dest_bar_hi);
-        bar_write32(logical_device_id, architecture_implementation->get_arc_csm_mailbox_offset() + 3 * 4, region_size);
+        const uint32_t arc_csm_mailbox_offset = architecture_implementation->get_arc_csm_mailbox_offset();
+        pci_device->reg_batch({
+            reg_batch_op::write(arc_csm_mailbox_offset + 0 * 4, region_id_to_use),
+            reg_batch_op::write(arc_csm_mailbox_offset + 1 * 4, dest_bar_lo),
+            reg_batch_op::write(arc_csm_mailbox_offset + 2 * 4, dest_bar_hi),
+            reg_batch_op::write(arc_csm_mailbox_offset + 3 * 4, region_size),
+        });
         arc_msg(
             logical_device_id,
             0xaa00 | architecture_implementation->get_arc_message_setup_iatu_for_peer_to_peer(),
@@ -1752,6 +2252,152 @@ void* Cluster::host_dma_address(std::uint64_t offset, chip_id_t src_device_id, u
     }
 }
 
+HostMemoryRegistrationCache& Cluster::get_host_memory_registration_cache(chip_id_t mmio_chip) {
+    auto cache = host_memory_registrations.find(mmio_chip);
+    if (cache == host_memory_registrations.end()) {
+        // Window 3 is left out, since the channel 3 window is shifted to work around an iATU limitation.
+        std::vector<std::uint32_t> windows = {};
+        for (int window = get_pci_device(mmio_chip)->get_num_host_mem_channels(); window < 3; window++) {
+            windows.push_back(window);
+        }
+        cache = host_memory_registrations.emplace(mmio_chip, HostMemoryRegistrationCache(windows)).first;
+    }
+    return cache->second;
+}
+
+uint64_t Cluster::register_host_memory(chip_id_t mmio_chip, void* ptr, std::size_t size) {
+    log_assert(arch_name != tt::ARCH::BLACKHOLE, "Host memory registration is not supported on Blackhole");
+    const std::lock_guard<std::mutex> lock(host_memory_registration_mutex);
+    PCIDevice* pci_device = get_pci_device(mmio_chip);
+    log_assert(
+        pci_device->get_num_host_mem_channels() > 0,
+        "Host memory registration needs hugepage channel 0 on device {}",
+        mmio_chip);
+    HostMemoryRegistrationCache& cache = get_host_memory_registration_cache(mmio_chip);
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+
+    std::optional<HostMemoryRegistration> registration = cache.acquire(address, size);
+    if (!registration) {
+        const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+        registration = HostMemoryRegistration{};
+        registration->start = address & ~(page_size - 1);
+        registration->size = ((address + size + page_size - 1) & ~(page_size - 1)) - registration->start;
+        log_assert(
+            registration->size <= HOST_MEMORY_WINDOW_SIZE,
+            "Host memory registrations are limited to {} bytes",
+            HOST_MEMORY_WINDOW_SIZE);
+        registration->iova =
+            pci_device->pin_host_memory(reinterpret_cast<void*>(registration->start), registration->size);
+
+        std::optional<HostMemoryRegistration> evicted;
+        try {
+            registration->window = cache.allocate_window(evicted);
+        } catch (...) {
+            pci_device->unpin_host_memory(reinterpret_cast<void*>(registration->start), registration->size);
+            throw;
+        }
+        if (evicted) {
+            log_debug(LogSiliconDriver, "Evicting host memory registration at 0x{:x}", evicted->start);
+            unmap_host_memory_window(mmio_chip, evicted->window);
+            pci_device->unpin_host_memory(reinterpret_cast<void*>(evicted->start), evicted->size);
+        }
+        // The device reaches the whole iATU region, so a smaller registration would expose the unpinned host memory
+        // past its end.
+        const uint32_t region_size =
+            get_host_memory_region_size(mmio_chip, registration->window, registration->size);
+        if (registration->size < region_size) {
+            pci_device->unpin_host_memory(reinterpret_cast<void*>(registration->start), registration->size);
+            throw std::runtime_error(fmt::format(
+                "Host memory registration of {} bytes is smaller than the {} byte iATU region of host memory "
+                "window {}, register a larger range",
+                registration->size,
+                region_size,
+                registration->window));
+        }
+        map_host_memory_window(mmio_chip, registration->window, registration->iova, region_size);
+        cache.insert(*registration);
+    }
+    return uint64_t(registration->window) * HOST_MEMORY_WINDOW_SIZE + (address - registration->start);
+}
+
+void Cluster::release_host_memory(chip_id_t mmio_chip, void* ptr) {
+    const std::lock_guard<std::mutex> lock(host_memory_registration_mutex);
+    get_host_memory_registration_cache(mmio_chip).release(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+void Cluster::unregister_host_memory(chip_id_t mmio_chip, void* ptr, std::size_t size) {
+    const std::lock_guard<std::mutex> lock(host_memory_registration_mutex);
+    PCIDevice* pci_device = get_pci_device(mmio_chip);
+    for (const auto& registration :
+         get_host_memory_registration_cache(mmio_chip).invalidate(reinterpret_cast<std::uintptr_t>(ptr), size)) {
+        unmap_host_memory_window(mmio_chip, registration.window);
+        pci_device->unpin_host_memory(reinterpret_cast<void*>(registration.start), registration.size);
+    }
+}
+
+uint32_t Cluster::get_host_memory_region_size(chip_id_t mmio_chip, uint32_t window, uint64_t size) {
+    // ARC places iATU region N at N times the region size, so a region smaller than its window has a larger id.
+    // ARC cannot disable regions either: a window keeps the regions of its earlier registrations, unmapped, and the
+    // new region has to be at least as large as them to cover them, and so have a lower id, which takes precedence.
+    std::map<uint32_t, uint32_t>& window_per_region = host_memory_window_per_region[mmio_chip];
+    auto region_of_size = [window](uint32_t region_size) { return window * (HOST_MEMORY_WINDOW_SIZE / region_size); };
+    auto region_available = [&](uint32_t region) {
+        if (region >= NUM_IATU_REGIONS) {
+            return false;
+        }
+        auto region_window = window_per_region.find(region);
+        if (region_window != window_per_region.end()) {
+            return region_window->second == window;
+        }
+        // Regions 0 to 2 map whole windows, those of the hugepage channels and of the other host memory windows.
+        return region == window || region >= 3;
+    };
+
+    uint32_t region_size = IATU_REGION_GRANULE;
+    for (const auto& [region, region_window] : window_per_region) {
+        if (region_window == window) {
+            region_size = std::max(region_size, HOST_MEMORY_WINDOW_SIZE / (region / window));
+        }
+    }
+    while (region_size < size || !region_available(region_of_size(region_size))) {
+        region_size *= 2;
+    }
+    return region_size;
+}
+
+void Cluster::map_host_memory_window(chip_id_t mmio_chip, uint32_t window, uint64_t target, uint32_t region_size) {
+    const uint32_t region = window * (HOST_MEMORY_WINDOW_SIZE / region_size);
+    std::map<uint32_t, uint32_t>& window_per_region = host_memory_window_per_region[mmio_chip];
+    window_per_region[region] = window;
+    // The region outlives this process and the session fingerprint does not cover it, so the device is not resumed.
+    session_records.at(get_pci_device(mmio_chip)->get_device_num())->invalidate_configuration();
+    iatu_configure_peer_region(mmio_chip, region, target, region_size);
+}
+
+void Cluster::unmap_host_memory_window(chip_id_t mmio_chip, uint32_t window) {
+    // ARC cannot disable a region, so the window is pointed at hugepage channel 0 instead, which the device reaches
+    // anyway. Only the window's largest region has to be moved, it takes precedence over the others.
+    const std::map<uint32_t, uint32_t>& window_per_region = host_memory_window_per_region.at(mmio_chip);
+    const auto region = std::find_if(window_per_region.begin(), window_per_region.end(), [window](const auto& entry) {
+        return entry.second == window;
+    });
+    log_assert(region != window_per_region.end(), "Host memory window {} is not mapped", window);
+    const uint32_t region_size = HOST_MEMORY_WINDOW_SIZE / (region->first / window);
+    iatu_configure_peer_region(
+        mmio_chip, region->first, get_pci_device(mmio_chip)->get_hugepage_mapping(0).physical_address, region_size);
+}
+
+void Cluster::clear_host_memory_registrations() {
+    const std::lock_guard<std::mutex> lock(host_memory_registration_mutex);
+    for (auto& [mmio_chip, cache] : host_memory_registrations) {
+        PCIDevice* pci_device = get_pci_device(mmio_chip);
+        for (const auto& registration : cache.clear()) {
+            unmap_host_memory_window(mmio_chip, registration.window);
+            pci_device->unpin_host_memory(reinterpret_cast<void*>(registration.start), registration.size);
+        }
+    }
+}
+
 // Wrapper for throwing more helpful exception when not-enabled pci intf is accessed.
 inline PCIDevice* Cluster::get_pci_device(int device_id) const {
     if (!m_pci_device_map.count(device_id)) {
@@ -1760,37 +2406,129 @@ inline PCIDevice* Cluster::get_pci_device(int device_id) const {
     return m_pci_device_map.at(device_id).get();
 }
 
-std::shared_ptr<boost::interprocess::named_mutex> Cluster::get_mutex(
-    const std::string& tlb_name, int pci_interface_id) {
+std::shared_ptr<ProfiledNamedMutex> Cluster::get_mutex(const std::string& tlb_name, int pci_interface_id) {
     std::string mutex_name = tlb_name + std::to_string(pci_interface_id);
     return hardware_resource_mutex_map.at(mutex_name);
 }
 
-uint64_t Cluster::get_sys_addr(uint32_t chip_x, uint32_t chip_y, uint32_t noc_x, uint32_t noc_y, uint64_t offset) {
-    uint64_t result = chip_y;
-    uint64_t noc_addr_local_bits_mask = (1UL << noc_params.noc_addr_local_bits) - 1;
-    result <<= noc_params.noc_addr_node_id_bits;
-    result |= chip_x;
-    result <<= noc_params.noc_addr_node_id_bits;
-    result |= noc_y;
-    result <<= noc_params.noc_addr_node_id_bits;
-    result |= noc_x;
-    result <<= noc_params.noc_addr_local_bits;
-    result |= (noc_addr_local_bits_mask & offset);
-    return result;
+Cluster::MmioChipGateway::MmioChipGateway(Cluster& cluster, chip_id_t mmio_chip) :
+    cluster(cluster), mmio_chip(mmio_chip) {}
+
+void Cluster::MmioChipGateway::write_to_eth_core(
+    const void* mem_ptr, std::uint32_t size_in_bytes, const tt_cxy_pair& eth_core, std::uint64_t address) {
+    cluster.write_device_memory(mem_ptr, size_in_bytes, eth_core, address, "LARGE_WRITE_TLB");
+}
+
+void Cluster::MmioChipGateway::read_from_eth_core(
+    void* mem_ptr, const tt_cxy_pair& eth_core, std::uint64_t address, std::uint32_t size_in_bytes) {
+    cluster.read_device_memory(mem_ptr, eth_core, address, size_in_bytes, "LARGE_READ_TLB");
+}
+
+// The ethernet routing buffers can only be mapped to host channel 0.
+void Cluster::MmioChipGateway::write_to_sysmem(
+    const void* mem_ptr, std::uint32_t size_in_bytes, std::uint64_t address) {
+    cluster.write_to_sysmem(mem_ptr, size_in_bytes, address, 0, mmio_chip);
+}
+
+void Cluster::MmioChipGateway::read_from_sysmem(void* mem_ptr, std::uint64_t address, std::uint32_t size_in_bytes) {
+    cluster.read_from_sysmem(mem_ptr, address, 0, size_in_bytes, mmio_chip);
 }
 
-uint16_t Cluster::get_sys_rack(uint32_t rack_x, uint32_t rack_y) {
-    uint32_t result = rack_y;
-    result <<= eth_interface_params.eth_rack_coord_width;
-    result |= rack_x;
+uint32_t Cluster::get_remote_transfer_queue_occupancy(chip_id_t mmio_chip) {
+    MmioChipGateway gateway(*this, mmio_chip);
+    const scoped_lock<ProfiledNamedMutex> lock(
+        *get_mutex(NON_MMIO_MUTEX_NAME, this->get_pci_device(mmio_chip)->get_device_num()));
+    const int active_core_for_txn = non_mmio_transfer_cores_customized ? active_eth_core_idx_per_chip.at(mmio_chip)
+                                                                       : active_core_per_chip.at(mmio_chip);
+    return remote_transfer_engine.get_queue_occupancy(
+        gateway, remote_transfer_ethernet_cores.at(mmio_chip)[active_core_for_txn]);
+}
+
+Cluster::LockedGateway::LockedGateway(GatewayAssignment& assignment) : assignment(&assignment) {
+    assignment.mutex.lock_shared();
+    gateway_assignments_locked_by_thread[&assignment]++;
+    mmio_chip = assignment.mmio_chip;
+}
+
+Cluster::LockedGateway::LockedGateway(LockedGateway&& other) noexcept :
+    assignment(std::exchange(other.assignment, nullptr)), mmio_chip(other.mmio_chip) {}
+
+Cluster::LockedGateway::~LockedGateway() {
+    if (assignment == nullptr) {
+        return;
+    }
+    auto locks = gateway_assignments_locked_by_thread.find(assignment);
+    if (--locks->second == 0) {
+        gateway_assignments_locked_by_thread.erase(locks);
+    }
+    assignment->mutex.unlock_shared();
+}
 
-    return result;
+bool Cluster::LockedGateway::is_held_by_this_thread(const GatewayAssignment& assignment) {
+    return gateway_assignments_locked_by_thread.count(&assignment) > 0;
 }
 
-bool Cluster::is_non_mmio_cmd_q_full(uint32_t curr_wptr, uint32_t curr_rptr) {
-    return (curr_wptr != curr_rptr) && ((curr_wptr & eth_interface_params.cmd_buf_size_mask) ==
-                                        (curr_rptr & eth_interface_params.cmd_buf_size_mask));
+Cluster::LockedGateway Cluster::get_remote_transfer_gateway(chip_id_t chip, uint64_t size_in_bytes) {
+    auto assignment = remote_transfer_gateway_per_chip.find(chip);
+    if (assignment == remote_transfer_gateway_per_chip.end()) {
+        // Not one of the target chips, so its transfers are never balanced.
+        return LockedGateway(cluster_desc->get_closest_mmio_capable_chip(chip));
+    }
+    if (LockedGateway::is_held_by_this_thread(assignment->second)) {
+        // The outer transfer keeps the chip where it is, and locking again could wait for a move behind it.
+        return LockedGateway(assignment->second.mmio_chip.load());
+    }
+    const chip_id_t gateway = assignment->second.mmio_chip;
+    if (!remote_transfer_load_balancing || size_in_bytes < remote_transfer_load_balancing_min_size) {
+        return LockedGateway(assignment->second);
+    }
+
+    // The queues are polled without holding any lock, the chip's lock is only taken exclusively to move it.
+
+    const auto& mmio_chips = cluster_desc->get_mmio_capable_chips_by_distance(chip);
+    if (mmio_chips.size() < 2) {
+        return LockedGateway(assignment->second);
+    }
+    const int max_distance = mmio_chips.front().second + remote_transfer_max_extra_hops;
+    chip_id_t least_loaded_gateway = gateway;
+    uint32_t least_occupancy = get_remote_transfer_queue_occupancy(gateway);
+    for (const auto& [mmio_chip, distance] : mmio_chips) {
+        if (distance > max_distance || least_occupancy == 0) {
+            break;
+        }
+        // Only MMIO chips opened by this cluster, with ethernet cores set up for remote transfers, can be used.
+        if (mmio_chip == gateway || m_pci_device_map.find(mmio_chip) == m_pci_device_map.end() ||
+            remote_transfer_ethernet_cores.at(mmio_chip).empty() ||
+            (non_mmio_transfer_cores_customized &&
+             active_eth_core_idx_per_chip.find(mmio_chip) == active_eth_core_idx_per_chip.end())) {
+            continue;
+        }
+        const uint32_t occupancy = get_remote_transfer_queue_occupancy(mmio_chip);
+        if (occupancy < least_occupancy) {
+            least_loaded_gateway = mmio_chip;
+            least_occupancy = occupancy;
+        }
+    }
+
+    if (least_loaded_gateway != gateway) {
+        // Waits for the transfers which already picked the previous MMIO chip to be queued.
+        const std::unique_lock<std::shared_mutex> lock(assignment->second.mutex);
+        // Another thread may have moved the chip since it was read above.
+        const chip_id_t previous_gateway = assignment->second.mmio_chip;
+        if (previous_gateway != least_loaded_gateway) {
+            log_debug(
+                LogSiliconDriver,
+                "Moving transfers to chip {} from MMIO chip {} to MMIO chip {}",
+                chip,
+                previous_gateway,
+                least_loaded_gateway);
+            // Commands already queued on the previous MMIO chip have to land before any sent through the new one.
+            wait_for_connected_non_mmio_flush(previous_gateway);
+            assignment->second.mmio_chip = least_loaded_gateway;
+        }
+    }
+    // Picks up the MMIO chip the chip is on once no move is in progress, which may be a later one than this one.
+    return LockedGateway(assignment->second);
 }
 
 /*
@@ -1802,7 +2540,7 @@ bool Cluster::is_non_mmio_cmd_q_full(uint32_t curr_wptr, uint32_t curr_rptr) {
  *  - read_from_non_mmio_device
  *
  * The non-MMIO read/write functions (excluding the `*_epoch_cmd` variants) are responsible for the
- * writes/reads to/from those wormhole chips that aren't memory mapped or directly host connected.
+ * writes/reads to/from those chips that aren't memory mapped or directly host connected.
  * To get the data to or from those other chips, there is a memory transfer protocol - initiated on
  * the host side but carried out by any number of the ethernet cores (the ethernet core pool is dictated
  * by `this->NUM_ETH_CORES_FOR_NON_MMIO_TRANSFERS`) on the MMIO chips (e.g. typically just the one chip in a galaxy).
@@ -1832,9 +2570,9 @@ bool Cluster::is_non_mmio_cmd_q_full(uint32_t curr_wptr, uint32_t curr_rptr) {
  * Considering the above, the current chosen approach is to make each of these calls acquired a shared mutex:
  * `NON_MMIO_MUTEX_NAME`
  *  - They acquire at a relatively large granularity -> for the entire duration of the function where we interact
- *    with the ethernet core (read/write) and where we use `active_core` to choose a core.
+ *    with the ethernet core (read/write) and where we use `active_core_per_chip` to choose a core.
  *    - Simplifies synchronization while we reach stability
- *  - We need to include any usage (read/modify) of `active_core` in the mutex acquisition scope.
+ *  - We need to include any usage (read/modify) of `active_core_per_chip` in the mutex acquisition scope.
  *
  * Other schemes may be more performant.
  */
@@ -1847,545 +2585,205 @@ bool Cluster::is_non_mmio_cmd_q_full(uint32_t curr_wptr, uint32_t curr_rptr) {
 
 void Cluster::write_to_non_mmio_device(
     const void* mem_ptr,
-    uint32_t size_in_bytes,
+    uint64_t size_in_bytes,
     tt_cxy_pair core,
     uint64_t address,
     bool broadcast,
     std::vector<int> broadcast_header) {
-    chip_id_t mmio_capable_chip_logical;
+    const LockedGateway gateway =
+        broadcast ? LockedGateway(core.chip) : get_remote_transfer_gateway(core.chip, size_in_bytes);
+    write_to_non_mmio_device(
+        mem_ptr, size_in_bytes, core, address, gateway.get_mmio_chip(), broadcast, std::move(broadcast_header));
+}
 
-    if (broadcast) {
-        mmio_capable_chip_logical = core.chip;
-    } else {
-        mmio_capable_chip_logical = cluster_desc->get_closest_mmio_capable_chip(core.chip);
-    }
-    flush_non_mmio_per_chip[cluster_desc->get_closest_mmio_capable_chip(core.chip)] = true;
+void Cluster::write_to_non_mmio_device(
+    const void* mem_ptr,
+    uint64_t size_in_bytes,
+    tt_cxy_pair core,
+    uint64_t address,
+    chip_id_t mmio_capable_chip_logical,
+    bool broadcast,
+    std::vector<int> broadcast_header) {
+    SegmentList<const uint8_t> source(Span<const uint8_t>(static_cast<const uint8_t*>(mem_ptr), size_in_bytes));
+    write_to_non_mmio_device(source, core, address, mmio_capable_chip_logical, broadcast, std::move(broadcast_header));
+}
 
+void Cluster::write_to_non_mmio_device(
+    SegmentList<const uint8_t>& source,
+    tt_cxy_pair core,
+    uint64_t address,
+    chip_id_t mmio_capable_chip_logical,
+    bool broadcast,
+    std::vector<int> broadcast_header) {
     if (non_mmio_transfer_cores_customized) {
         log_assert(
             active_eth_core_idx_per_chip.find(mmio_capable_chip_logical) != active_eth_core_idx_per_chip.end(),
             "Ethernet Cores for Host to Cluster communication were not initialized for all MMIO devices.");
     }
+    // Blackhole SoC descriptors can list too few ethernet cores for remote transfers.
+    log_assert(
+        mmio_capable_chip_logical < remote_transfer_ethernet_cores.size() &&
+            !remote_transfer_ethernet_cores[mmio_capable_chip_logical].empty(),
+        "MMIO chip {} has no ethernet cores for remote transfers",
+        mmio_capable_chip_logical);
 
-    using data_word_t = uint32_t;
-    constexpr int DATA_WORD_SIZE = sizeof(data_word_t);
-    constexpr int BROADCAST_HEADER_SIZE = sizeof(data_word_t) * 8;  // Broadcast header is 8 words
     const auto target_chip = cluster_desc->get_chip_locations().at(core.chip);
-
-    std::string write_tlb = "LARGE_WRITE_TLB";
-    std::string read_tlb = "LARGE_READ_TLB";
-    std::string empty_tlb = "";
     translate_to_noc_table_coords(core.chip, core.y, core.x);
-    std::vector<std::uint32_t> erisc_command;
-    std::vector<std::uint32_t> erisc_q_rptr = std::vector<uint32_t>(1);
-    std::vector<std::uint32_t> erisc_q_ptrs =
-        std::vector<uint32_t>(eth_interface_params.remote_update_ptr_size_bytes * 2 / sizeof(uint32_t));
-
-    std::vector<std::uint32_t> data_block;
-
-    routing_cmd_t* new_cmd;
-
-    uint32_t buffer_id = 0;
-    uint32_t timestamp = 0;  // CMD_TIMESTAMP;
-    bool use_dram;
-    uint32_t max_block_size;
-
-    // Broadcast requires block writes to host dram
-    use_dram = broadcast || (size_in_bytes > 256 * DATA_WORD_SIZE);
-    max_block_size = use_dram ? host_address_params.eth_routing_block_size : eth_interface_params.max_block_size;
+    MmioChipGateway gateway(*this, mmio_capable_chip_logical);
 
     //
     //                    MUTEX ACQUIRE (NON-MMIO)
     //  do not locate any ethernet core reads/writes before this acquire
     //
-    const scoped_lock<named_mutex> lock(
+    TraceScope mutex_wait("Wait for non-MMIO mutex", TraceCategory::MutexWait, mmio_capable_chip_logical);
+    const scoped_lock<ProfiledNamedMutex> lock(
         *get_mutex(NON_MMIO_MUTEX_NAME, this->get_pci_device(mmio_capable_chip_logical)->get_device_num()));
-
-    int& active_core_for_txn =
-        non_mmio_transfer_cores_customized ? active_eth_core_idx_per_chip.at(mmio_capable_chip_logical) : active_core;
-    tt_cxy_pair remote_transfer_ethernet_core =
-        remote_transfer_ethernet_cores.at(mmio_capable_chip_logical)[active_core_for_txn];
-
-    erisc_command.resize(sizeof(routing_cmd_t) / DATA_WORD_SIZE);
-    new_cmd = (routing_cmd_t*)&erisc_command[0];
-    read_device_memory(
-        erisc_q_ptrs.data(),
-        remote_transfer_ethernet_core,
-        eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-        eth_interface_params.remote_update_ptr_size_bytes * 2,
-        read_tlb);
-    uint32_t full_count = 0;
-    uint32_t offset = 0;
-    uint32_t block_size;
-
-    bool full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
-    erisc_q_rptr.resize(1);
-    erisc_q_rptr[0] = erisc_q_ptrs[4];
-    while (offset < size_in_bytes) {
-        while (full) {
-            read_device_memory(
-                erisc_q_rptr.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
-                    eth_interface_params.remote_update_ptr_size_bytes,
-                DATA_WORD_SIZE,
-                read_tlb);
-            full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr[0]);
-            full_count++;
-        }
-        // full = true;
-        //  set full only if this command will make the q full.
-        //  otherwise full stays false so that we do not poll the rd pointer in next iteration.
-        //  As long as current command push does not fill up the queue completely, we do not want
-        //  to poll rd pointer in every iteration.
-        // full = is_non_mmio_cmd_q_full((erisc_q_ptrs[0] + 1) & CMD_BUF_PTR_MASK, erisc_q_rptr[0]);
-
-        uint32_t req_wr_ptr = erisc_q_ptrs[0] & eth_interface_params.cmd_buf_size_mask;
-        if ((address + offset) & 0x1F) {  // address not 32-byte aligned
-            block_size = DATA_WORD_SIZE;  // 4 byte aligned
-        } else {
-            // For broadcast we prepend a 32byte header. Decrease block size (size of payload) by this amount.
-            block_size = offset + max_block_size > size_in_bytes + 32 * broadcast ? size_in_bytes - offset
-                                                                                  : max_block_size - 32 * broadcast;
-            // Explictly align block_size to 4 bytes, in case the input buffer is not uint32_t aligned
-            uint32_t alignment_mask = sizeof(uint32_t) - 1;
-            block_size = (block_size + alignment_mask) & ~alignment_mask;
-        }
-        // For 4 byte aligned data, transfer_size always == block_size. For unaligned data, transfer_size < block_size
-        // in the last block
-        uint64_t transfer_size =
-            std::min(block_size, size_in_bytes - offset);  // Host side data size that needs to be copied
-        // Use block mode for broadcast
-        uint32_t req_flags = (broadcast || (block_size > DATA_WORD_SIZE))
-                                 ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_wr_req | timestamp)
-                                 : eth_interface_params.cmd_wr_req;
-        uint32_t resp_flags = block_size > DATA_WORD_SIZE
-                                  ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_wr_ack)
-                                  : eth_interface_params.cmd_wr_ack;
-        timestamp = 0;
-
-        if (broadcast) {
-            req_flags |= eth_interface_params.cmd_broadcast;
-        }
-
-        uint32_t host_dram_block_addr =
-            host_address_params.eth_routing_buffers_start +
-            (active_core_for_txn * eth_interface_params.cmd_buf_size + req_wr_ptr) * max_block_size;
-        uint16_t host_dram_channel = 0;  // This needs to be 0, since WH can only map ETH buffers to chan 0.
-
-        if (req_flags & eth_interface_params.cmd_data_block) {
-            // Copy data to sysmem or device DRAM for Block mode
-            if (use_dram) {
-                req_flags |= eth_interface_params.cmd_data_block_dram;
-                resp_flags |= eth_interface_params.cmd_data_block_dram;
-                size_buffer_to_capacity(data_block, block_size);
-                memcpy(&data_block[0], (uint8_t*)mem_ptr + offset, transfer_size);
-                if (broadcast) {
-                    // Write broadcast header to sysmem
-                    write_to_sysmem(
-                        broadcast_header.data(),
-                        broadcast_header.size() * sizeof(uint32_t),
-                        host_dram_block_addr,
-                        host_dram_channel,
-                        mmio_capable_chip_logical);
-                }
-                // Write payload to sysmem
-                write_to_sysmem(
-                    data_block.data(),
-                    data_block.size() * DATA_WORD_SIZE,
-                    host_dram_block_addr + BROADCAST_HEADER_SIZE * broadcast,
-                    host_dram_channel,
-                    mmio_capable_chip_logical);
-
-            } else {
-                uint32_t buf_address = eth_interface_params.eth_routing_data_buffer_addr + req_wr_ptr * max_block_size;
-                size_buffer_to_capacity(data_block, block_size);
-                memcpy(&data_block[0], (uint8_t*)mem_ptr + offset, transfer_size);
-                write_device_memory(
-                    data_block.data(),
-                    data_block.size() * DATA_WORD_SIZE,
-                    remote_transfer_ethernet_core,
-                    buf_address,
-                    write_tlb);
-            }
-            tt_driver_atomics::sfence();
-        }
-
-        // Send the read request
-        log_assert(
-            broadcast || (req_flags == eth_interface_params.cmd_wr_req) || (((address + offset) % 32) == 0),
-            "Block mode address must be 32-byte aligned.");  // Block mode address must be 32-byte aligned.
-
-        if (broadcast) {
-            // Only specify endpoint local address for broadcast
-            new_cmd->sys_addr = address + offset;
-        } else {
-            new_cmd->sys_addr = get_sys_addr(target_chip.x, target_chip.y, core.x, core.y, address + offset);
-            new_cmd->rack = get_sys_rack(target_chip.rack, target_chip.shelf);
-        }
-
-        if (req_flags & eth_interface_params.cmd_data_block) {
-            // Block mode
-            new_cmd->data = block_size + BROADCAST_HEADER_SIZE * broadcast;
-        } else {
-            if (size_in_bytes - offset < sizeof(uint32_t)) {
-                // Handle misalignment at the end of the buffer:
-                // Assemble a padded uint32_t from single bytes, in case we have less than 4 bytes remaining
-                memcpy(&new_cmd->data, static_cast<const uint8_t*>(mem_ptr) + offset, size_in_bytes - offset);
-            } else {
-                new_cmd->data = *((uint32_t*)mem_ptr + offset / DATA_WORD_SIZE);
-            }
-        }
-
-        new_cmd->flags = req_flags;
-        if (use_dram) {
-            new_cmd->src_addr_tag = host_dram_block_addr;
-        }
-        write_device_memory(
-            erisc_command.data(),
-            erisc_command.size() * DATA_WORD_SIZE,
-            remote_transfer_ethernet_core,
-            eth_interface_params.request_routing_cmd_queue_base + (sizeof(routing_cmd_t) * req_wr_ptr),
-            write_tlb);
-        tt_driver_atomics::sfence();
-
-        erisc_q_ptrs[0] = (erisc_q_ptrs[0] + 1) & eth_interface_params.cmd_buf_ptr_mask;
-        std::vector<std::uint32_t> erisc_q_wptr;
-        erisc_q_wptr.resize(1);
-        erisc_q_wptr[0] = erisc_q_ptrs[0];
-        write_device_memory(
-            erisc_q_wptr.data(),
-            erisc_q_wptr.size() * DATA_WORD_SIZE,
-            remote_transfer_ethernet_core,
-            eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-            write_tlb);
-        tt_driver_atomics::sfence();
-
-        offset += transfer_size;
-
-        // If there is more data to send and this command will make the q full, switch to next Q.
-        // otherwise full stays false so that we do not poll the rd pointer in next iteration.
-        // As long as current command push does not fill up the queue completely, we do not want
-        // to poll rd pointer in every iteration.
-
-        if (is_non_mmio_cmd_q_full((erisc_q_ptrs[0]) & eth_interface_params.cmd_buf_ptr_mask, erisc_q_rptr[0])) {
-            active_core_for_txn++;
-            uint32_t update_mask_for_chip = remote_transfer_ethernet_cores[mmio_capable_chip_logical].size() - 1;
-            active_core_for_txn =
-                non_mmio_transfer_cores_customized
-                    ? (active_core_for_txn & update_mask_for_chip)
-                    : ((active_core_for_txn & NON_EPOCH_ETH_CORES_MASK) + NON_EPOCH_ETH_CORES_START_ID);
-            // active_core = (active_core & NON_EPOCH_ETH_CORES_MASK) + NON_EPOCH_ETH_CORES_START_ID;
-            remote_transfer_ethernet_core =
-                remote_transfer_ethernet_cores.at(mmio_capable_chip_logical)[active_core_for_txn];
-            read_device_memory(
-                erisc_q_ptrs.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-                eth_interface_params.remote_update_ptr_size_bytes * 2,
-                read_tlb);
-            full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
-            erisc_q_rptr[0] = erisc_q_ptrs[4];
+    mutex_wait.end();
+
+    const std::vector<tt_cxy_pair>& eth_cores = remote_transfer_ethernet_cores.at(mmio_capable_chip_logical);
+    int& active_core_for_txn = non_mmio_transfer_cores_customized
+                                   ? active_eth_core_idx_per_chip.at(mmio_capable_chip_logical)
+                                   : active_core_per_chip.at(mmio_capable_chip_logical);
+    // Writes rotate through all customized cores, and otherwise keep off the cores reserved for epoch commands.
+    const RemoteTransferCores cores = {
+        eth_cores,
+        active_core_for_txn,
+        non_mmio_transfer_cores_customized ? 0 : static_cast<int>(NON_EPOCH_ETH_CORES_START_ID),
+        non_mmio_transfer_cores_customized ? static_cast<std::uint32_t>(eth_cores.size() - 1)
+                                           : NON_EPOCH_ETH_CORES_MASK};
+    // Ethernet cores the write is queued on, which a flush of the target chip has to wait for.
+    const std::uint32_t eth_core_mask = remote_transfer_engine.write(
+        gateway, cores, source, target_chip, core, address, broadcast, broadcast_header);
+
+    // Only added once the commands are queued, so that a flush which does not see them yet is not waiting for them.
+    flush_non_mmio_per_chip.at(mmio_capable_chip_logical).add(eth_core_mask);
+    if (broadcast) {
+        // Broadcasts reach every remote chip.
+        for (auto& [remote_chip, pending_writes] : eth_cores_to_flush_per_remote_chip) {
+            pending_writes.add(eth_core_mask);
         }
+    } else if (auto pending_writes = eth_cores_to_flush_per_remote_chip.find(core.chip);
+               pending_writes != eth_cores_to_flush_per_remote_chip.end()) {
+        pending_writes->second.add(eth_core_mask);
     }
 }
 
 /*
  * Note that this function is required to acquire the `NON_MMIO_MUTEX_NAME` mutex for interacting with the ethernet core
- * (host) command queue DO NOT use `active_core` or issue any pcie reads/writes to the ethernet core prior to acquiring
- * the mutex. For extra information, see the "NON_MMIO_MUTEX Usage" above
+ * (host) command queue DO NOT use `active_core_per_chip` or issue any pcie reads/writes to the ethernet core prior to
+ * acquiring the mutex. For extra information, see the "NON_MMIO_MUTEX Usage" above
  */
-void Cluster::read_from_non_mmio_device(void* mem_ptr, tt_cxy_pair core, uint64_t address, uint32_t size_in_bytes) {
-    using data_word_t = uint32_t;
-    constexpr int DATA_WORD_SIZE = sizeof(data_word_t);
-    std::string write_tlb = "LARGE_WRITE_TLB";
-    std::string read_tlb = "LARGE_READ_TLB";
-    std::string empty_tlb = "";
-    translate_to_noc_table_coords(core.chip, core.y, core.x);
-
-    const auto& mmio_capable_chip_logical = cluster_desc->get_closest_mmio_capable_chip(core.chip);
-    const eth_coord_t target_chip = cluster_desc->get_chip_locations().at(core.chip);
-
-    std::vector<std::uint32_t> erisc_command;
-    std::vector<std::uint32_t> erisc_q_rptr;
-    std::vector<std::uint32_t> erisc_q_ptrs =
-        std::vector<uint32_t>(eth_interface_params.remote_update_ptr_size_bytes * 2 / DATA_WORD_SIZE);
-    std::vector<std::uint32_t> erisc_resp_q_wptr = std::vector<uint32_t>(1);
-    std::vector<std::uint32_t> erisc_resp_q_rptr = std::vector<uint32_t>(1);
-
-    std::vector<std::uint32_t> data_block;
+void Cluster::read_from_non_mmio_device(void* mem_ptr, tt_cxy_pair core, uint64_t address, uint64_t size_in_bytes) {
+    const LockedGateway gateway = get_remote_transfer_gateway(core.chip, size_in_bytes);
+    read_from_non_mmio_device(mem_ptr, core, address, size_in_bytes, gateway.get_mmio_chip(), std::nullopt);
+}
 
-    routing_cmd_t* new_cmd;
+void Cluster::read_from_non_mmio_device(
+    void* mem_ptr,
+    tt_cxy_pair core,
+    uint64_t address,
+    uint64_t size_in_bytes,
+    chip_id_t mmio_capable_chip_logical,
+    std::optional<uint64_t> sysmem_offset) {
+    SegmentList<uint8_t> destination(Span<uint8_t>(static_cast<uint8_t*>(mem_ptr), size_in_bytes));
+    read_from_non_mmio_device(destination, core, address, mmio_capable_chip_logical, sysmem_offset);
+}
 
-    erisc_command.resize(sizeof(routing_cmd_t) / DATA_WORD_SIZE);
-    new_cmd = (routing_cmd_t*)&erisc_command[0];
+void Cluster::read_from_non_mmio_device(
+    SegmentList<uint8_t>& destination,
+    tt_cxy_pair core,
+    uint64_t address,
+    chip_id_t mmio_capable_chip_logical,
+    std::optional<uint64_t> sysmem_offset) {
+    log_assert(
+        mmio_capable_chip_logical < remote_transfer_ethernet_cores.size() &&
+            !remote_transfer_ethernet_cores[mmio_capable_chip_logical].empty(),
+        "MMIO chip {} has no ethernet cores for remote transfers",
+        mmio_capable_chip_logical);
+    translate_to_noc_table_coords(core.chip, core.y, core.x);
+    const eth_coord_t target_chip = cluster_desc->get_chip_locations().at(core.chip);
+    MmioChipGateway gateway(*this, mmio_capable_chip_logical);
 
     //
     //                    MUTEX ACQUIRE (NON-MMIO)
     //  do not locate any ethernet core reads/writes before this acquire
     //
-    const scoped_lock<named_mutex> lock(
+    TraceScope mutex_wait("Wait for non-MMIO mutex", TraceCategory::MutexWait, mmio_capable_chip_logical);
+    const scoped_lock<ProfiledNamedMutex> lock(
         *get_mutex(NON_MMIO_MUTEX_NAME, this->get_pci_device(mmio_capable_chip_logical)->get_device_num()));
+    mutex_wait.end();
     const tt_cxy_pair remote_transfer_ethernet_core = remote_transfer_ethernet_cores[mmio_capable_chip_logical].at(0);
 
-    read_device_memory(
-        erisc_q_ptrs.data(),
-        remote_transfer_ethernet_core,
-        eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-        eth_interface_params.remote_update_ptr_size_bytes * 2,
-        read_tlb);
-    read_device_memory(
-        erisc_resp_q_wptr.data(),
-        remote_transfer_ethernet_core,
-        eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-        DATA_WORD_SIZE,
-        read_tlb);
-    read_device_memory(
-        erisc_resp_q_rptr.data(),
-        remote_transfer_ethernet_core,
-        eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
-            eth_interface_params.remote_update_ptr_size_bytes,
-        DATA_WORD_SIZE,
-        read_tlb);
-
-    bool full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
-    erisc_q_rptr.resize(1);
-    erisc_q_rptr[0] = erisc_q_ptrs[4];
-
-    bool use_dram;
-    uint32_t max_block_size;
-
-    use_dram = size_in_bytes > 1024;
-    max_block_size = use_dram ? host_address_params.eth_routing_block_size : eth_interface_params.max_block_size;
-
-    uint32_t offset = 0;
-    uint32_t block_size;
-    uint32_t buffer_id = 0;
-
-    while (offset < size_in_bytes) {
-        while (full) {
-            read_device_memory(
-                erisc_q_rptr.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
-                    eth_interface_params.remote_update_ptr_size_bytes,
-                DATA_WORD_SIZE,
-                read_tlb);
-            full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr[0]);
-        }
-
-        uint32_t req_wr_ptr = erisc_q_ptrs[0] & eth_interface_params.cmd_buf_size_mask;
-        if ((address + offset) & 0x1F) {  // address not 32-byte aligned
-            block_size = DATA_WORD_SIZE;  // 4 byte aligned block
-        } else {
-            block_size = offset + max_block_size > size_in_bytes ? size_in_bytes - offset : max_block_size;
-            // Align up to 4 bytes.
-            uint32_t alignment_mask = sizeof(uint32_t) - 1;
-            block_size = (block_size + alignment_mask) & ~alignment_mask;
-        }
-        uint32_t req_flags = block_size > DATA_WORD_SIZE
-                                 ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_rd_req)
-                                 : eth_interface_params.cmd_rd_req;
-        uint32_t resp_flags = block_size > DATA_WORD_SIZE
-                                  ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_rd_data)
-                                  : eth_interface_params.cmd_rd_data;
-        uint32_t resp_rd_ptr = erisc_resp_q_rptr[0] & eth_interface_params.cmd_buf_size_mask;
-        uint32_t host_dram_block_addr = host_address_params.eth_routing_buffers_start + resp_rd_ptr * max_block_size;
-        uint16_t host_dram_channel = 0;  // This needs to be 0, since WH can only map ETH buffers to chan 0.
-
-        if (use_dram && block_size > DATA_WORD_SIZE) {
-            req_flags |= eth_interface_params.cmd_data_block_dram;
-            resp_flags |= eth_interface_params.cmd_data_block_dram;
-        }
-
-        // Send the read request
-        log_assert(
-            (req_flags == eth_interface_params.cmd_rd_req) || (((address + offset) & 0x1F) == 0),
-            "Block mode offset must be 32-byte aligned.");  // Block mode offset must be 32-byte aligned.
-        new_cmd->sys_addr = get_sys_addr(target_chip.x, target_chip.y, core.x, core.y, address + offset);
-        new_cmd->rack = get_sys_rack(target_chip.rack, target_chip.shelf);
-        new_cmd->data = block_size;
-        new_cmd->flags = req_flags;
-        if (use_dram) {
-            new_cmd->src_addr_tag = host_dram_block_addr;
-        }
-        write_device_memory(
-            erisc_command.data(),
-            erisc_command.size() * DATA_WORD_SIZE,
-            remote_transfer_ethernet_core,
-            eth_interface_params.request_routing_cmd_queue_base + (sizeof(routing_cmd_t) * req_wr_ptr),
-            write_tlb);
-        ;
-        tt_driver_atomics::sfence();
+    remote_transfer_engine.read(
+        gateway, remote_transfer_ethernet_core, destination, target_chip, core, address, sysmem_offset);
+}
 
-        erisc_q_ptrs[0] = (erisc_q_ptrs[0] + 1) & eth_interface_params.cmd_buf_ptr_mask;
-        std::vector<std::uint32_t> erisc_q_wptr;
-        erisc_q_wptr.resize(1);
-        erisc_q_wptr[0] = erisc_q_ptrs[0];
-        write_device_memory(
-            erisc_q_wptr.data(),
-            erisc_q_wptr.size() * DATA_WORD_SIZE,
-            remote_transfer_ethernet_core,
-            eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-            write_tlb);
-        tt_driver_atomics::sfence();
-        // If there is more data to read and this command will make the q full, set full to 1.
-        // otherwise full stays false so that we do not poll the rd pointer in next iteration.
-        // As long as current command push does not fill up the queue completely, we do not want
-        // to poll rd pointer in every iteration.
-
-        if (is_non_mmio_cmd_q_full((erisc_q_ptrs[0]), erisc_q_rptr[0])) {
-            read_device_memory(
-                erisc_q_ptrs.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-                eth_interface_params.remote_update_ptr_size_bytes * 2,
-                read_tlb);
-            full = is_non_mmio_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
-            erisc_q_rptr[0] = erisc_q_ptrs[4];
-        }
-
-        // Wait for read request completion and extract the data into the `mem_ptr`
-
-        // erisc firmware will:
-        // 1. clear response flags
-        // 2. start operation
-        // 3. advance response wrptr
-        // 4. complete operation and write data into response or buffer
-        // 5. set response flags
-        // So we have to wait for wrptr to advance, then wait for flags to be nonzero, then read data.
-
-        do {
-            read_device_memory(
-                erisc_resp_q_wptr.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-                DATA_WORD_SIZE,
-                read_tlb);
-        } while (erisc_resp_q_rptr[0] == erisc_resp_q_wptr[0]);
-        tt_driver_atomics::lfence();
-        uint32_t flags_offset = 12 + sizeof(routing_cmd_t) * resp_rd_ptr;
-        std::vector<std::uint32_t> erisc_resp_flags = std::vector<uint32_t>(1);
-        do {
-            read_device_memory(
-                erisc_resp_flags.data(),
-                remote_transfer_ethernet_core,
-                eth_interface_params.response_routing_cmd_queue_base + flags_offset,
-                DATA_WORD_SIZE,
-                read_tlb);
-        } while (erisc_resp_flags[0] == 0);
-
-        if (erisc_resp_flags[0] == resp_flags) {
-            tt_driver_atomics::lfence();
-            uint32_t data_offset = 8 + sizeof(routing_cmd_t) * resp_rd_ptr;
-            if (block_size == DATA_WORD_SIZE) {
-                std::vector<std::uint32_t> erisc_resp_data = std::vector<uint32_t>(1);
-                read_device_memory(
-                    erisc_resp_data.data(),
-                    remote_transfer_ethernet_core,
-                    eth_interface_params.response_routing_cmd_queue_base + data_offset,
-                    DATA_WORD_SIZE,
-                    read_tlb);
-                if (size_in_bytes - offset < 4) {
-                    // Handle misaligned (4 bytes) data at the end of the block.
-                    // Only read remaining bytes into the host buffer, instead of reading the full uint32_t
-                    std::memcpy((uint8_t*)mem_ptr + offset, erisc_resp_data.data(), size_in_bytes - offset);
-                } else {
-                    *((uint32_t*)mem_ptr + offset / DATA_WORD_SIZE) = erisc_resp_data[0];
-                }
-            } else {
-                // Read 4 byte aligned block from device/sysmem
-                if (use_dram) {
-                    size_buffer_to_capacity(data_block, block_size);
-                    read_from_sysmem(
-                        data_block.data(),
-                        host_dram_block_addr,
-                        host_dram_channel,
-                        block_size,
-                        mmio_capable_chip_logical);
-                } else {
-                    uint32_t buf_address =
-                        eth_interface_params.eth_routing_data_buffer_addr + resp_rd_ptr * max_block_size;
-                    size_buffer_to_capacity(data_block, block_size);
-                    read_device_memory(
-                        data_block.data(), remote_transfer_ethernet_core, buf_address, block_size, read_tlb);
-                }
-                // assert(mem_ptr.size() - (offset/DATA_WORD_SIZE) >= (block_size * DATA_WORD_SIZE));
-                log_assert(
-                    (data_block.size() * DATA_WORD_SIZE) >= block_size,
-                    "Incorrect data size read back from sysmem/device");
-                // Account for misalignment by skipping any padding bytes in the copied data_block
-                memcpy((uint8_t*)mem_ptr + offset, data_block.data(), std::min(block_size, size_in_bytes - offset));
-            }
+void Cluster::PendingRemoteWrites::add(std::uint32_t eth_core_mask) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    queued++;
+    for (std::size_t core = 0; core < last_queued_per_core.size(); core++) {
+        if (eth_core_mask & (1u << core)) {
+            last_queued_per_core[core] = queued;
         }
-
-        // Finally increment the rdptr for the response command q
-        erisc_resp_q_rptr[0] = (erisc_resp_q_rptr[0] + 1) & eth_interface_params.cmd_buf_ptr_mask;
-        write_device_memory(
-            erisc_resp_q_rptr.data(),
-            erisc_resp_q_rptr.size() * DATA_WORD_SIZE,
-            remote_transfer_ethernet_core,
-            eth_interface_params.response_cmd_queue_base + sizeof(remote_update_ptr_t) +
-                eth_interface_params.cmd_counters_size_bytes,
-            write_tlb);
-        tt_driver_atomics::sfence();
-        log_assert(erisc_resp_flags[0] == resp_flags, "Unexpected ERISC Response Flags.");
-
-        offset += block_size;
     }
 }
 
-void Cluster::wait_for_connected_non_mmio_flush(const chip_id_t chip_id) {
-    if (flush_non_mmio_per_chip[chip_id]) {
-        log_assert(arch_name != tt::ARCH::BLACKHOLE, "Non-MMIO flush not supported in Blackhole");
-        std::string read_tlb = "LARGE_READ_TLB";
-        auto chips_with_mmio = this->get_target_mmio_device_ids();
-
-        if (chips_with_mmio.find(chip_id) == chips_with_mmio.end()) {
-            log_debug(
-                LogSiliconDriver, "Chip {} is not an MMIO chip, skipping wait_for_connected_non_mmio_flush", chip_id);
-            return;
+std::pair<std::uint32_t, std::uint64_t> Cluster::PendingRemoteWrites::get_unflushed() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    std::uint32_t eth_core_mask = 0;
+    for (std::size_t core = 0; core < last_queued_per_core.size(); core++) {
+        if (last_queued_per_core[core] > flushed) {
+            eth_core_mask |= 1u << core;
         }
+    }
+    return {eth_core_mask, queued};
+}
 
-        if (arch_name == tt::ARCH::WORMHOLE_B0) {
-            std::vector<std::uint32_t> erisc_txn_counters = std::vector<uint32_t>(2);
-            std::vector<std::uint32_t> erisc_q_ptrs =
-                std::vector<uint32_t>(eth_interface_params.remote_update_ptr_size_bytes * 2 / sizeof(uint32_t));
-
-            // wait for all queues to be empty.
-            for (tt_cxy_pair& cxy : remote_transfer_ethernet_cores.at(chip_id)) {
-                do {
-                    read_device_memory(
-                        erisc_q_ptrs.data(),
-                        cxy,
-                        eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
-                        eth_interface_params.remote_update_ptr_size_bytes * 2,
-                        read_tlb);
-                } while (erisc_q_ptrs[0] != erisc_q_ptrs[4]);
-            }
-            // wait for all write responses to come back.
-            for (tt_cxy_pair& cxy : remote_transfer_ethernet_cores.at(chip_id)) {
-                do {
-                    read_device_memory(
-                        erisc_txn_counters.data(), cxy, eth_interface_params.request_cmd_queue_base, 8, read_tlb);
-                } while (erisc_txn_counters[0] != erisc_txn_counters[1]);
-            }
-        }
-        flush_non_mmio_per_chip[chip_id] = false;
+void Cluster::PendingRemoteWrites::set_flushed(std::uint64_t write_number) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    // A concurrent flush which started later may have finished first.
+    flushed = std::max(flushed, write_number);
+}
+
+void Cluster::wait_for_connected_non_mmio_flush(const chip_id_t chip_id) {
+    auto pending_writes = flush_non_mmio_per_chip.find(chip_id);
+    if (pending_writes == flush_non_mmio_per_chip.end()) {
+        log_debug(LogSiliconDriver, "Chip {} is not an MMIO chip, skipping wait_for_connected_non_mmio_flush", chip_id);
+        return;
+    }
+    // Only marked flushed once the cores were waited for, so that a concurrent flush does not skip the wait.
+    const auto [eth_core_mask, last_write] = pending_writes->second.get_unflushed();
+    if (eth_core_mask != 0) {
+        wait_for_remote_transfer_cores(chip_id, eth_core_mask);
+        pending_writes->second.set_flushed(last_write);
     }
 }
 
-void Cluster::wait_for_non_mmio_flush(const chip_id_t chip_id) {
-    log_assert(arch_name != tt::ARCH::BLACKHOLE, "Non-MMIO flush not supported in Blackhole");
-    std::string read_tlb = "LARGE_READ_TLB";
+void Cluster::wait_for_remote_transfer_cores(chip_id_t mmio_chip, std::uint32_t eth_core_mask) {
+    MmioChipGateway gateway(*this, mmio_chip);
+    remote_transfer_engine.wait_for_cores(gateway, remote_transfer_ethernet_cores.at(mmio_chip), eth_core_mask);
+}
 
+void Cluster::wait_for_non_mmio_flush(const chip_id_t chip_id) {
     if (!this->cluster_desc->is_chip_remote(chip_id)) {
         log_debug(LogSiliconDriver, "Chip {} is not a remote chip, skipping wait_for_non_mmio_flush", chip_id);
         return;
     }
 
-    chip_id_t mmio_connected_chip = cluster_desc->get_closest_mmio_capable_chip(chip_id);
-    wait_for_connected_non_mmio_flush(mmio_connected_chip);
+    const LockedGateway gateway = get_remote_transfer_gateway(chip_id, 0);
+    const chip_id_t mmio_connected_chip = gateway.get_mmio_chip();
+    auto pending_writes = eth_cores_to_flush_per_remote_chip.find(chip_id);
+    if (pending_writes == eth_cores_to_flush_per_remote_chip.end()) {
+        wait_for_connected_non_mmio_flush(mmio_connected_chip);
+        return;
+    }
+    // As in wait_for_connected_non_mmio_flush, the cores are only marked flushed once they were waited for, so that a
+    // concurrent memory barrier on the chip does not start before the writes were acked.
+    const auto [eth_core_mask, last_write] = pending_writes->second.get_unflushed();
+    if (eth_core_mask != 0) {
+        wait_for_remote_transfer_cores(mmio_connected_chip, eth_core_mask);
+        pending_writes->second.set_flushed(last_write);
+    }
 }
 
 void Cluster::wait_for_non_mmio_flush() {
@@ -2445,100 +2843,117 @@ void Cluster::generate_tensix_broadcast_grids_for_grayskull(
 }
 
 std::unordered_map<chip_id_t, std::vector<std::vector<int>>>& Cluster::get_ethernet_broadcast_headers(
+    const std::set<chip_id_t>& chips_to_exclude) {
+    // Entries are never removed, so the returned reference stays valid after the lock is released.
+    const std::lock_guard<std::mutex> lock(bcast_header_cache_mutex);
+    auto headers = bcast_header_cache.find(chips_to_exclude);
+    if (headers == bcast_header_cache.end()) {
+        headers = bcast_header_cache
+                      .insert(
+                          {chips_to_exclude,
+                           generate_ethernet_broadcast_headers(
+                               cluster_desc.get(),
+                               target_devices_in_cluster,
+                               *(get_target_mmio_device_ids().begin()),
+                               chips_to_exclude)})
+                      .first;
+    }
+    return headers->second;
+}
+
+std::unordered_map<chip_id_t, std::vector<std::vector<int>>> Cluster::generate_ethernet_broadcast_headers(
+    tt_ClusterDescriptor* cluster_desc,
+    const std::set<chip_id_t>& target_devices,
+    chip_id_t first_mmio_chip,
     const std::set<chip_id_t>& chips_to_exclude) {
     // Generate headers for Ethernet Broadcast (WH) only. Each header corresponds to a unique broadcast "grid".
-    if (bcast_header_cache.find(chips_to_exclude) == bcast_header_cache.end()) {
-        bcast_header_cache[chips_to_exclude] = {};
-        std::unordered_map<chip_id_t, std::unordered_map<chip_id_t, std::vector<int>>>
-            broadcast_mask_for_target_chips_per_group = {};
-        std::map<std::vector<int>, std::tuple<chip_id_t, std::vector<int>>> broadcast_header_union_per_group = {};
-        chip_id_t first_mmio_chip = *(get_target_mmio_device_ids().begin());
-        for (const auto& chip : target_devices_in_cluster) {
-            if (chips_to_exclude.find(chip) == chips_to_exclude.end()) {
-                // Get shelf local physical chip id included in broadcast
-                chip_id_t physical_chip_id = cluster_desc->get_shelf_local_physical_chip_coords(chip);
-                eth_coord_t eth_coords = cluster_desc->get_chip_locations().at(chip);
-                // Rack word to be set in header
-                uint32_t rack_word = eth_coords.rack >> 2;
-                // Rack byte to be set in header
-                uint32_t rack_byte = eth_coords.rack % 4;
-                // 1st level grouping: Group broadcasts based on the MMIO chip they must go through
-                // Nebula + Galaxy Topology assumption: Disjoint sets can only be present in the first shelf, with each
-                // set connected to host through its closest MMIO chip For the first shelf, pass broadcasts to specific
-                // chips through their closest MMIO chip All other shelves are fully connected galaxy grids. These are
-                // connected to all MMIO devices. Use any (or the first) MMIO device in the list.
-                chip_id_t closest_mmio_chip = 0;
-                if (eth_coords.rack == 0 && eth_coords.shelf == 0) {
-                    // Shelf 0 + Rack 0: Either an MMIO chip or a remote chip potentially connected to host through its
-                    // own MMIO counterpart.
-                    closest_mmio_chip = cluster_desc->get_closest_mmio_capable_chip(chip);
-                } else {
-                    // All other shelves: Group these under the same/first MMIO chip, since all MMIO chips are
-                    // connected.
-                    closest_mmio_chip = first_mmio_chip;
-                }
-                if (broadcast_mask_for_target_chips_per_group.find(closest_mmio_chip) ==
-                    broadcast_mask_for_target_chips_per_group.end()) {
-                    broadcast_mask_for_target_chips_per_group.insert({closest_mmio_chip, {}});
-                }
-                // For each target physical chip id (local to a shelf), generate headers based on all racks and shelves
-                // that contain this physical id.
-                if (broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip).find(physical_chip_id) ==
-                    broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip).end()) {
-                    // Target seen for the first time.
-                    std::vector<int> broadcast_mask(8, 0);
-                    broadcast_mask.at(rack_word) |= (1 << eth_coords.shelf) << rack_byte;
-                    broadcast_mask.at(3) |= 1 << physical_chip_id;
-                    broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip)
-                        .insert({physical_chip_id, broadcast_mask});
+    std::unordered_map<chip_id_t, std::vector<std::vector<int>>> broadcast_headers = {};
+    std::unordered_map<chip_id_t, std::unordered_map<chip_id_t, std::vector<int>>>
+        broadcast_mask_for_target_chips_per_group = {};
+    std::map<std::vector<int>, std::tuple<chip_id_t, std::vector<int>>> broadcast_header_union_per_group = {};
+    for (const auto& chip : target_devices) {
+        if (chips_to_exclude.find(chip) == chips_to_exclude.end()) {
+            // Get shelf local physical chip id included in broadcast
+            chip_id_t physical_chip_id = cluster_desc->get_shelf_local_physical_chip_coords(chip);
+            eth_coord_t eth_coords = cluster_desc->get_chip_locations().at(chip);
+            // Rack word to be set in header
+            uint32_t rack_word = eth_coords.rack >> 2;
+            // Rack byte to be set in header
+            uint32_t rack_byte = eth_coords.rack % 4;
+            // 1st level grouping: Group broadcasts based on the MMIO chip they must go through
+            // Nebula + Galaxy Topology assumption: Disjoint sets can only be present in the first shelf, with each
+            // set connected to host through its closest MMIO chip For the first shelf, pass broadcasts to specific
+            // chips through their closest MMIO chip All other shelves are fully connected galaxy grids. These are
+            // connected to all MMIO devices. Use any (or the first) MMIO device in the list.
+            chip_id_t closest_mmio_chip = 0;
+            if (eth_coords.rack == 0 && eth_coords.shelf == 0) {
+                // Shelf 0 + Rack 0: Either an MMIO chip or a remote chip potentially connected to host through its
+                // own MMIO counterpart.
+                closest_mmio_chip = cluster_desc->get_closest_mmio_capable_chip(chip);
+            } else {
+                // All other shelves: Group these under the same/first MMIO chip, since all MMIO chips are
+                // connected.
+                closest_mmio_chip = first_mmio_chip;
+            }
+            if (broadcast_mask_for_target_chips_per_group.find(closest_mmio_chip) ==
+                broadcast_mask_for_target_chips_per_group.end()) {
+                broadcast_mask_for_target_chips_per_group.insert({closest_mmio_chip, {}});
+            }
+            // For each target physical chip id (local to a shelf), generate headers based on all racks and shelves
+            // that contain this physical id.
+            if (broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip).find(physical_chip_id) ==
+                broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip).end()) {
+                // Target seen for the first time.
+                std::vector<int> broadcast_mask(8, 0);
+                broadcast_mask.at(rack_word) |= (1 << eth_coords.shelf) << rack_byte;
+                broadcast_mask.at(3) |= 1 << physical_chip_id;
+                broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip)
+                    .insert({physical_chip_id, broadcast_mask});
 
-                } else {
-                    // Target was seen before -> include curr rack and shelf in header
-                    broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip)
-                        .at(physical_chip_id)
-                        .at(rack_word) |= static_cast<uint32_t>(1 << eth_coords.shelf) << rack_byte;
-                }
+            } else {
+                // Target was seen before -> include curr rack and shelf in header
+                broadcast_mask_for_target_chips_per_group.at(closest_mmio_chip)
+                    .at(physical_chip_id)
+                    .at(rack_word) |= static_cast<uint32_t>(1 << eth_coords.shelf) << rack_byte;
             }
         }
-        // 2nd level grouping: For each MMIO group, further group the chips based on their rack and shelf headers. The
-        // number of groups after this step represent the final set of broadcast grids.
-        for (auto& mmio_group : broadcast_mask_for_target_chips_per_group) {
-            for (auto& chip : mmio_group.second) {
-                // Generate a hash for this MMIO Chip + Rack + Shelf group
-                std::vector<int> header_hash = {
-                    mmio_group.first, chip.second.at(0), chip.second.at(1), chip.second.at(2)};
-                if (broadcast_header_union_per_group.find(header_hash) == broadcast_header_union_per_group.end()) {
-                    broadcast_header_union_per_group.insert(
-                        {header_hash, std::make_tuple(mmio_group.first, chip.second)});
-                } else {
-                    // If group found, update chip header entry
-                    std::get<1>(broadcast_header_union_per_group.at(header_hash)).at(3) |= chip.second.at(3);
-                }
+    }
+    // 2nd level grouping: For each MMIO group, further group the chips based on their rack and shelf headers. The
+    // number of groups after this step represent the final set of broadcast grids.
+    for (auto& mmio_group : broadcast_mask_for_target_chips_per_group) {
+        for (auto& chip : mmio_group.second) {
+            // Generate a hash for this MMIO Chip + Rack + Shelf group
+            std::vector<int> header_hash = {mmio_group.first, chip.second.at(0), chip.second.at(1), chip.second.at(2)};
+            if (broadcast_header_union_per_group.find(header_hash) == broadcast_header_union_per_group.end()) {
+                broadcast_header_union_per_group.insert({header_hash, std::make_tuple(mmio_group.first, chip.second)});
+            } else {
+                // If group found, update chip header entry
+                std::get<1>(broadcast_header_union_per_group.at(header_hash)).at(3) |= chip.second.at(3);
             }
         }
-        // Get all broadcast headers per MMIO group
-        for (const auto& header : broadcast_header_union_per_group) {
-            chip_id_t mmio_chip = std::get<0>(header.second);
-            if (bcast_header_cache[chips_to_exclude].find(mmio_chip) == bcast_header_cache[chips_to_exclude].end()) {
-                bcast_header_cache[chips_to_exclude].insert({mmio_chip, {}});
-            }
-            bcast_header_cache[chips_to_exclude].at(mmio_chip).push_back(std::get<1>(header.second));
-        }
-        // Invert headers (FW convention)
-        for (auto& bcast_group : bcast_header_cache[chips_to_exclude]) {
-            for (auto& header : bcast_group.second) {
-                int header_idx = 0;
-                for (auto& header_entry : header) {
-                    if (header_idx == 4) {
-                        break;
-                    }
-                    header_entry = ~header_entry;
-                    header_idx++;
+    }
+    // Get all broadcast headers per MMIO group
+    for (const auto& header : broadcast_header_union_per_group) {
+        chip_id_t mmio_chip = std::get<0>(header.second);
+        if (broadcast_headers.find(mmio_chip) == broadcast_headers.end()) {
+            broadcast_headers.insert({mmio_chip, {}});
+        }
+        broadcast_headers.at(mmio_chip).push_back(std::get<1>(header.second));
+    }
+    // Invert headers (FW convention)
+    for (auto& bcast_group : broadcast_headers) {
+        for (auto& header : bcast_group.second) {
+            int header_idx = 0;
+            for (auto& header_entry : header) {
+                if (header_idx == 4) {
+                    break;
                 }
+                header_entry = ~header_entry;
+                header_idx++;
             }
         }
     }
-    return bcast_header_cache[chips_to_exclude];
+    return broadcast_headers;
 }
 
 void Cluster::pcie_broadcast_write(
@@ -2554,7 +2969,7 @@ void Cluster::pcie_broadcast_write(
     PCIDevice* pci_device = get_pci_device(chip);
     const auto tlb_index = dynamic_tlb_config.at(fallback_tlb);
     const uint8_t* buffer_addr = static_cast<const uint8_t*>(mem_ptr);
-    const scoped_lock<named_mutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
+    const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
     while (size_in_bytes > 0) {
         auto [mapped_address, tlb_size] = pci_device->set_dynamic_tlb_broadcast(
             tlb_index,
@@ -2792,6 +3207,102 @@ void Cluster::broadcast_write_to_cluster(
     }
 }
 
+void Cluster::broadcast_write_to_cluster(
+    const void* mem_ptr,
+    uint32_t size_in_bytes,
+    uint64_t address,
+    const std::set<chip_id_t>& chips_to_exclude,
+    const CoreSet& cores,
+    const std::string& fallback_tlb) {
+    const tt_xy_pair grid_size = get_soc_descriptor(*target_devices_in_cluster.begin()).grid_size;
+    // Broadcasts to the cores at the crossings of the rows and columns in the masks.
+    const auto broadcast_to_rows_and_columns = [&](std::uint64_t row_mask, std::uint64_t column_mask) {
+        log_assert(
+            (row_mask >> grid_size.y) == 0 && (column_mask >> grid_size.x) == 0,
+            "Broadcast cores are outside of the {} grid.",
+            grid_size.str());
+        std::set<uint32_t> rows_to_exclude = {};
+        std::set<uint32_t> cols_to_exclude = {};
+        for (uint32_t y = 0; y < grid_size.y; y++) {
+            if (!(row_mask & (std::uint64_t(1) << y))) {
+                rows_to_exclude.insert(y);
+            }
+        }
+        for (uint32_t x = 0; x < grid_size.x; x++) {
+            if (!(column_mask & (std::uint64_t(1) << x))) {
+                cols_to_exclude.insert(x);
+            }
+        }
+        broadcast_write_to_cluster(
+            mem_ptr, size_in_bytes, address, chips_to_exclude, rows_to_exclude, cols_to_exclude, fallback_tlb);
+    };
+
+    // Sets such as the whole worker grid are reached with a single broadcast. Splitting them into rectangles would
+    // leave tensix rows out of each broadcast, which ERISC FW older than 6.8.0 does not support.
+    if (const auto rows_and_columns = cores.to_rows_and_columns()) {
+        broadcast_to_rows_and_columns(rows_and_columns->first, rows_and_columns->second);
+        return;
+    }
+    for (const auto& [start, end] : cores.to_rectangles()) {
+        const auto rows_and_columns = CoreSet::rectangle(start, end).to_rows_and_columns();
+        broadcast_to_rows_and_columns(rows_and_columns->first, rows_and_columns->second);
+    }
+}
+
+void Cluster::broadcast_fill_cluster(
+    const void* pattern,
+    uint32_t pattern_size,
+    uint64_t size_in_bytes,
+    uint64_t address,
+    const std::set<chip_id_t>& chips_to_exclude,
+    const CoreSet& cores,
+    const std::string& fallback_tlb) {
+    log_assert(
+        pattern_size > 0 && pattern_size <= FILL_CHUNK_SIZE,
+        "Fill pattern size {} must be between 1 and {} bytes",
+        pattern_size,
+        FILL_CHUNK_SIZE);
+    if (size_in_bytes == 0) {
+        return;
+    }
+
+    // Every chunk but the last is a whole number of patterns, so that the pattern continues across chunks.
+    const uint32_t chunk_size = std::min<uint64_t>(size_in_bytes, FILL_CHUNK_SIZE / pattern_size * pattern_size);
+    std::vector<uint8_t> chunk(chunk_size);
+    for (uint32_t offset = 0; offset < chunk_size; offset += pattern_size) {
+        std::memcpy(chunk.data() + offset, pattern, std::min(pattern_size, chunk_size - offset));
+    }
+
+    for (uint64_t offset = 0; offset < size_in_bytes; offset += chunk_size) {
+        broadcast_write_to_cluster(
+            chunk.data(),
+            std::min<uint64_t>(chunk_size, size_in_bytes - offset),
+            address + offset,
+            chips_to_exclude,
+            cores,
+            fallback_tlb);
+    }
+}
+
+void Cluster::broadcast_fill_cluster(
+    const void* pattern,
+    uint32_t pattern_size,
+    uint64_t size_in_bytes,
+    uint64_t address,
+    const std::set<chip_id_t>& chips_to_exclude,
+    const std::unordered_set<uint32_t>& channels,
+    const std::string& fallback_tlb) {
+    const tt_SocDescriptor& soc_descriptor = get_soc_descriptor(*target_devices_in_cluster.begin());
+    CoreSet dram_cores_to_fill = {};
+    for (int chan = 0; chan < soc_descriptor.get_num_dram_channels(); chan++) {
+        if (channels.empty() || channels.find(chan) != channels.end()) {
+            dram_cores_to_fill.insert(soc_descriptor.get_core_for_dram_channel(chan, 0));
+        }
+    }
+    broadcast_fill_cluster(
+        pattern, pattern_size, size_in_bytes, address, chips_to_exclude, dram_cores_to_fill, fallback_tlb);
+}
+
 int Cluster::remote_arc_msg(
     int chip,
     uint32_t msg_code,
@@ -2801,6 +3312,7 @@ int Cluster::remote_arc_msg(
     int timeout,
     uint32_t* return_3,
     uint32_t* return_4) {
+    TraceScope trace("ARC message", TraceCategory::ArcMessage, chip, msg_code);
     constexpr uint64_t ARC_RESET_SCRATCH_ADDR = 0x880030060;
     constexpr uint64_t ARC_RESET_MISC_CNTL_ADDR = 0x880030100;
 
@@ -2877,14 +3389,23 @@ void Cluster::read_from_sysmem(void* mem_ptr, uint64_t addr, uint16_t channel, u
     read_buffer(mem_ptr, addr, channel, size, src_device_id);
 }
 
+void Cluster::write_to_sysmem(
+    Span<const std::uint8_t> data, uint64_t addr, uint16_t channel, chip_id_t src_device_id) {
+    write_buffer(data.data(), data.size(), addr, channel, src_device_id);
+}
+
+void Cluster::read_from_sysmem(Span<std::uint8_t> data, uint64_t addr, uint16_t channel, chip_id_t src_device_id) {
+    read_buffer(data.data(), addr, channel, data.size(), src_device_id);
+}
+
 void Cluster::set_membar_flag(
     const chip_id_t chip,
-    const std::unordered_set<tt_xy_pair>& cores,
+    const CoreSet& cores,
     const uint32_t barrier_value,
     const uint32_t barrier_addr,
     const std::string& fallback_tlb) {
     tt_driver_atomics::sfence();  // Ensure that writes before this do not get reordered
-    std::unordered_set<tt_xy_pair> cores_synced = {};
+    CoreSet cores_synced = {};
     std::vector<uint32_t> barrier_val_vec = {barrier_value};
     for (const auto& core : cores) {
         write_to_device(
@@ -2895,9 +3416,9 @@ void Cluster::set_membar_flag(
             fallback_tlb);
     }
     tt_driver_atomics::sfence();  // Ensure that all writes in the Host WC buffer are flushed
-    while (cores_synced.size() != cores.size()) {
+    while (cores_synced != cores) {
         for (const auto& core : cores) {
-            if (cores_synced.find(core) == cores_synced.end()) {
+            if (!cores_synced.contains(core)) {
                 uint32_t readback_val;
                 read_from_device(
                     &readback_val, tt_cxy_pair(chip, core), barrier_addr, sizeof(std::uint32_t), fallback_tlb);
@@ -2920,17 +3441,23 @@ void Cluster::set_membar_flag(
 
 void Cluster::insert_host_to_device_barrier(
     const chip_id_t chip,
-    const std::unordered_set<tt_xy_pair>& cores,
+    const CoreSet& cores,
     const uint32_t barrier_addr,
     const std::string& fallback_tlb) {
-    // Ensure that this memory barrier is atomic across processes/threads
-    const scoped_lock<named_mutex> lock(
-        *get_mutex(MEM_BARRIER_MUTEX_NAME, this->get_pci_device(chip)->get_device_num()));
+    // Ensure that this memory barrier is atomic across processes/threads. Barriers on remote chips use the mutex of the
+    // MMIO chip their flags are written through.
+    // The gateway stays locked, so the flag writes nested in the barrier go through the same MMIO chip.
+    const LockedGateway gateway = get_transfer_gateway(chip, 0);
+    const chip_id_t mmio_chip = gateway.get_mmio_chip();
+    const scoped_lock<ProfiledNamedMutex> lock(
+        *get_mutex(MEM_BARRIER_MUTEX_NAME, this->get_pci_device(mmio_chip)->get_device_num()));
     set_membar_flag(chip, cores, tt_MemBarFlag::SET, barrier_addr, fallback_tlb);
     set_membar_flag(chip, cores, tt_MemBarFlag::RESET, barrier_addr, fallback_tlb);
 }
 
 void Cluster::init_membars() {
+    // Flags of remote chips are left as they are, the barrier protocol does not depend on their initial value. Their
+    // ethernet firmware is only verified after the MMIO chips are initialized.
     for (const auto& chip : target_devices_in_cluster) {
         if (cluster_desc->is_chip_mmio_capable(chip)) {
             set_membar_flag(
@@ -2947,90 +3474,182 @@ void Cluster::init_membars() {
     }
 }
 
-void Cluster::l1_membar(
-    const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores) {
-    if (cluster_desc->is_chip_mmio_capable(chip)) {
-        const auto& all_workers = workers_per_chip.at(chip);
-        const auto& all_eth = eth_cores;
-        if (cores.size()) {
-            // Insert barrier on specific cores with L1
-            std::unordered_set<tt_xy_pair> workers_to_sync = {};
-            std::unordered_set<tt_xy_pair> eth_to_sync = {};
-
-            for (const auto& core : cores) {
-                if (all_workers.find(core) != all_workers.end()) {
-                    workers_to_sync.insert(core);
-                } else if (all_eth.find(core) != all_eth.end()) {
-                    eth_to_sync.insert(core);
-                } else {
-                    log_fatal("Can only insert an L1 Memory barrier on Tensix or Ethernet cores.");
-                }
-            }
-            insert_host_to_device_barrier(
-                chip, workers_to_sync, l1_address_params.tensix_l1_barrier_base, fallback_tlb);
-            insert_host_to_device_barrier(chip, eth_to_sync, l1_address_params.eth_l1_barrier_base, fallback_tlb);
-        } else {
-            // Insert barrier on all cores with L1
-            insert_host_to_device_barrier(chip, all_workers, l1_address_params.tensix_l1_barrier_base, fallback_tlb);
-            insert_host_to_device_barrier(chip, all_eth, l1_address_params.eth_l1_barrier_base, fallback_tlb);
+void Cluster::l1_membar(const chip_id_t chip, const std::string& fallback_tlb, const CoreSet& cores) {
+    TraceScope trace("L1 membar", TraceCategory::Membar, chip);
+    if (!cluster_desc->is_chip_mmio_capable(chip)) {
+        // The flags are written through the same ethernet queues as the writes to the chip, which must be done first.
+        wait_for_non_mmio_flush(chip);
+    }
+    const auto& all_workers = workers_per_chip.at(chip);
+    const auto& all_eth = eth_cores;
+    if (!cores.empty()) {
+        // Insert barrier on specific cores with L1
+        if (!cores.is_subset_of(all_workers | all_eth)) {
+            log_fatal("Can only insert an L1 Memory barrier on Tensix or Ethernet cores.");
         }
+        const CoreSet workers_to_sync = cores & all_workers;
+        const CoreSet eth_to_sync = cores & all_eth;
+        insert_host_to_device_barrier(chip, workers_to_sync, l1_address_params.tensix_l1_barrier_base, fallback_tlb);
+        insert_host_to_device_barrier(chip, eth_to_sync, l1_address_params.eth_l1_barrier_base, fallback_tlb);
     } else {
-        wait_for_non_mmio_flush();
+        // Insert barrier on all cores with L1
+        insert_host_to_device_barrier(chip, all_workers, l1_address_params.tensix_l1_barrier_base, fallback_tlb);
+        insert_host_to_device_barrier(chip, all_eth, l1_address_params.eth_l1_barrier_base, fallback_tlb);
     }
 }
 
-void Cluster::dram_membar(
-    const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores) {
-    if (cluster_desc->is_chip_mmio_capable(chip)) {
-        if (cores.size()) {
-            for (const auto& core : cores) {
-                log_assert(
-                    dram_cores.find(core) != dram_cores.end(), "Can only insert a DRAM Memory barrier on DRAM cores.");
-            }
-            insert_host_to_device_barrier(chip, cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
-        } else {
-            // Insert Barrier on all DRAM Cores
-            insert_host_to_device_barrier(chip, dram_cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
-        }
+void Cluster::dram_membar(const chip_id_t chip, const std::string& fallback_tlb, const CoreSet& cores) {
+    TraceScope trace("DRAM membar", TraceCategory::Membar, chip);
+    if (!cluster_desc->is_chip_mmio_capable(chip)) {
+        wait_for_non_mmio_flush(chip);
+    }
+    if (!cores.empty()) {
+        log_assert(cores.is_subset_of(dram_cores), "Can only insert a DRAM Memory barrier on DRAM cores.");
+        insert_host_to_device_barrier(chip, cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
     } else {
-        wait_for_non_mmio_flush();
+        // Insert Barrier on all DRAM Cores
+        insert_host_to_device_barrier(chip, dram_cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
     }
 }
 
 void Cluster::dram_membar(
     const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<uint32_t>& channels) {
-    if (cluster_desc->is_chip_mmio_capable(chip)) {
-        if (channels.size()) {
-            std::unordered_set<tt_xy_pair> dram_cores_to_sync = {};
-            for (const auto& chan : channels) {
-                dram_cores_to_sync.insert(get_soc_descriptor(chip).get_core_for_dram_channel(chan, 0));
-            }
-            insert_host_to_device_barrier(
-                chip, dram_cores_to_sync, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
-        } else {
-            // Insert Barrier on all DRAM Cores
-            insert_host_to_device_barrier(chip, dram_cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
+    TraceScope trace("DRAM membar", TraceCategory::Membar, chip);
+    if (!cluster_desc->is_chip_mmio_capable(chip)) {
+        wait_for_non_mmio_flush(chip);
+    }
+    if (channels.size()) {
+        CoreSet dram_cores_to_sync = {};
+        for (const auto& chan : channels) {
+            dram_cores_to_sync.insert(get_soc_descriptor(chip).get_core_for_dram_channel(chan, 0));
         }
+        insert_host_to_device_barrier(chip, dram_cores_to_sync, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
     } else {
-        wait_for_non_mmio_flush();
+        // Insert Barrier on all DRAM Cores
+        insert_host_to_device_barrier(chip, dram_cores, dram_address_params.DRAM_BARRIER_BASE, fallback_tlb);
     }
 }
 
 void Cluster::write_to_device(
     const void* mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb) {
+    write_to_device(
+        Span<const std::uint8_t>(static_cast<const std::uint8_t*>(mem_ptr), size), core, addr, fallback_tlb);
+}
+
+void Cluster::write_to_device(
+    Span<const std::uint8_t> data, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb) {
+    TraceScope trace("Write to device", TraceCategory::Transfer, core.chip, data.size());
     bool target_is_mmio_capable = cluster_desc->is_chip_mmio_capable(core.chip);
     if (target_is_mmio_capable) {
         if (fallback_tlb == "REG_TLB") {
-            write_mmio_device_register(mem_ptr, core, addr, size, fallback_tlb);
+            log_assert(
+                data.size() <= std::numeric_limits<uint32_t>::max(), "Register writes must be smaller than 4GB");
+            write_mmio_device_register(data.data(), core, addr, data.size(), fallback_tlb);
         } else {
-            write_device_memory(mem_ptr, size, core, addr, fallback_tlb);
+            write_device_memory(data.data(), data.size(), core, addr, fallback_tlb);
         }
     } else {
-        log_assert(arch_name != tt::ARCH::BLACKHOLE, "Non-MMIO targets not supported in Blackhole");
         log_assert(
             (get_soc_descriptor(core.chip).ethernet_cores).size() > 0 && get_number_of_chips_in_cluster() > 1,
             "Cannot issue ethernet writes to a single chip cluster!");
-        write_to_non_mmio_device(mem_ptr, size, core, addr);
+        write_to_non_mmio_device(data.data(), data.size(), core, addr);
+    }
+}
+
+void Cluster::scatter_write_to_cluster(const std::vector<tt_scatter_write>& writes, const std::string& fallback_tlb) {
+    std::map<chip_id_t, uint64_t> bytes_per_chip = {};
+    uint64_t total_bytes = 0;
+    for (const auto& write : writes) {
+        bytes_per_chip[write.core.chip] += write.size_in_bytes;
+        total_bytes += write.size_in_bytes;
+    }
+    TraceScope trace("Scatter write to cluster", TraceCategory::Transfer, -1, total_bytes);
+
+    // As in gather_read_from_cluster, every MMIO chip gets one thread for itself and the remote chips written through
+    // it. The writes keep their order within a chip.
+    // The gateways stay locked until every write is queued.
+    std::map<chip_id_t, LockedGateway> gateway_per_chip = {};
+    for (const auto& [chip, bytes] : bytes_per_chip) {
+        gateway_per_chip.emplace(chip, get_transfer_gateway(chip, bytes));
+    }
+    std::map<chip_id_t, std::vector<const tt_scatter_write*>> writes_per_gateway = {};
+    for (const auto& write : writes) {
+        writes_per_gateway[gateway_per_chip.at(write.core.chip).get_mmio_chip()].push_back(&write);
+    }
+
+    std::map<chip_id_t, std::function<void()>> transfers_per_gateway = {};
+    for (const auto& [gateway, gateway_writes] : writes_per_gateway) {
+        transfers_per_gateway[gateway] = [&, gateway = gateway, gateway_writes = &gateway_writes] {
+            bool wrote_remote_chip = false;
+            for (const tt_scatter_write* write : *gateway_writes) {
+                TraceScope write_trace(
+                    "Scatter write to chip", TraceCategory::Transfer, write->core.chip, write->size_in_bytes);
+                if (write->core.chip != gateway) {
+                    write_to_non_mmio_device(
+                        write->mem_ptr, write->size_in_bytes, write->core, write->address, gateway, false, {});
+                    wrote_remote_chip = true;
+                } else if (fallback_tlb == "REG_TLB") {
+                    write_mmio_device_register(
+                        write->mem_ptr, write->core, write->address, write->size_in_bytes, fallback_tlb);
+                } else {
+                    write_device_memory(
+                        write->mem_ptr, write->size_in_bytes, write->core, write->address, fallback_tlb);
+                }
+            }
+            if (wrote_remote_chip) {
+                wait_for_connected_non_mmio_flush(gateway);
+            }
+        };
+    }
+    run_per_gateway_in_parallel(transfers_per_gateway);
+    tt_driver_atomics::sfence();
+}
+
+void Cluster::write_to_device_posted(
+    const void* mem_ptr, uint64_t size_in_bytes, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb) {
+    if (!cluster_desc->is_chip_mmio_capable(core.chip)) {
+        // Remote writes are completed through the non-MMIO flush instead, see posted_write_barrier.
+        write_to_device(
+            Span<const std::uint8_t>(static_cast<const std::uint8_t*>(mem_ptr), size_in_bytes),
+            core,
+            addr,
+            fallback_tlb);
+        return;
+    }
+    log_assert(fallback_tlb != "REG_TLB", "Posted writes are not supported through REG_TLB");
+    if (size_in_bytes == 0) {
+        return;
+    }
+
+    TraceScope trace("Posted write to device", TraceCategory::Transfer, core.chip, size_in_bytes);
+    write_device_memory(mem_ptr, size_in_bytes, core, addr, fallback_tlb, TLB_DATA::Posted);
+    trace.end();
+
+    uint64_t last_word_addr = (addr + size_in_bytes - 1) & ~static_cast<uint64_t>(sizeof(uint32_t) - 1);
+    PendingPostedWrites& pending_writes = pending_posted_writes_per_chip.at(core.chip);
+    const std::lock_guard<std::mutex> lock(pending_writes.mutex);
+    pending_writes.last_word_addr_per_core[tt_xy_pair(core.x, core.y)] = last_word_addr;
+}
+
+void Cluster::posted_write_barrier(const chip_id_t chip) {
+    if (!cluster_desc->is_chip_mmio_capable(chip)) {
+        wait_for_non_mmio_flush(chip);
+        return;
+    }
+
+    std::unordered_map<tt_xy_pair, uint64_t> last_word_addr_per_core = {};
+    {
+        PendingPostedWrites& pending_writes = pending_posted_writes_per_chip.at(chip);
+        const std::lock_guard<std::mutex> lock(pending_writes.mutex);
+        last_word_addr_per_core.swap(pending_writes.last_word_addr_per_core);
+    }
+
+    // Drain host write-combining buffers, then read back through a strict TLB. The read is ordered behind all
+    // previous writes to the same core, so once it returns the posted writes have landed.
+    tt_driver_atomics::sfence();
+    for (const auto& [core, address] : last_word_addr_per_core) {
+        uint32_t readback = 0;
+        read_mmio_device_register(&readback, tt_cxy_pair(chip, core), address, sizeof(readback), "REG_TLB");
     }
 }
 
@@ -3039,11 +3658,15 @@ void Cluster::read_mmio_device_register(
     PCIDevice* pci_device = get_pci_device(core.chip);
 
     const auto tlb_index = dynamic_tlb_config.at(fallback_tlb);
-    const scoped_lock<named_mutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
+    TraceScope mutex_wait("Wait for TLB mutex", TraceCategory::MutexWait, core.chip);
+    const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
+    mutex_wait.end();
     log_debug(LogSiliconDriver, "  dynamic tlb_index: {}", tlb_index);
 
+    TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, core.chip, addr);
     auto [mapped_address, tlb_size] =
         pci_device->set_dynamic_tlb(tlb_index, core, addr, harvested_coord_translation.at(core.chip), TLB_DATA::Strict);
+    reprogram.end();
     // Align block to 4bytes if needed.
     auto aligned_buf = tt_4_byte_aligned_buffer(mem_ptr, size);
     pci_device->read_regs(mapped_address, aligned_buf.block_size / sizeof(std::uint32_t), aligned_buf.local_storage);
@@ -3059,11 +3682,15 @@ void Cluster::write_mmio_device_register(
     PCIDevice* pci_device = get_pci_device(core.chip);
 
     const auto tlb_index = dynamic_tlb_config.at(fallback_tlb);
-    const scoped_lock<named_mutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
+    TraceScope mutex_wait("Wait for TLB mutex", TraceCategory::MutexWait, core.chip);
+    const scoped_lock<ProfiledNamedMutex> lock(*get_mutex(fallback_tlb, pci_device->get_device_num()));
+    mutex_wait.end();
     log_debug(LogSiliconDriver, "  dynamic tlb_index: {}", tlb_index);
 
+    TraceScope reprogram("Reprogram TLB", TraceCategory::TlbReprogram, core.chip, addr);
     auto [mapped_address, tlb_size] =
         pci_device->set_dynamic_tlb(tlb_index, core, addr, harvested_coord_translation.at(core.chip), TLB_DATA::Strict);
+    reprogram.end();
     // Align block to 4bytes if needed.
     auto aligned_buf = tt_4_byte_aligned_buffer(mem_ptr, size);
     if (aligned_buf.input_size != aligned_buf.block_size) {
@@ -3075,24 +3702,162 @@ void Cluster::write_mmio_device_register(
 
 void Cluster::read_from_device(
     void* mem_ptr, tt_cxy_pair core, uint64_t addr, uint32_t size, const std::string& fallback_tlb) {
+    read_from_device(Span<std::uint8_t>(static_cast<std::uint8_t*>(mem_ptr), size), core, addr, fallback_tlb);
+}
+
+void Cluster::read_from_device(
+    Span<std::uint8_t> data, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb) {
+    TraceScope trace("Read from device", TraceCategory::Transfer, core.chip, data.size());
     bool target_is_mmio_capable = cluster_desc->is_chip_mmio_capable(core.chip);
     if (target_is_mmio_capable) {
         if (fallback_tlb == "REG_TLB") {
-            read_mmio_device_register(mem_ptr, core, addr, size, fallback_tlb);
+            log_assert(
+                data.size() <= std::numeric_limits<uint32_t>::max(), "Register reads must be smaller than 4GB");
+            read_mmio_device_register(data.data(), core, addr, data.size(), fallback_tlb);
         } else {
-            read_device_memory(mem_ptr, core, addr, size, fallback_tlb);
+            read_device_memory(data.data(), core, addr, data.size(), fallback_tlb);
         }
     } else {
-        log_assert(
-            arch_name != tt::ARCH::BLACKHOLE,
-            "Non-MMIO targets not supported in Blackhole");  // MT: Use only dynamic TLBs and never program static
         log_assert(
             (get_soc_descriptor(core.chip).ethernet_cores).size() > 0 && get_number_of_chips_in_cluster() > 1,
             "Cannot issue ethernet reads from a single chip cluster!");
-        read_from_non_mmio_device(mem_ptr, core, addr, size);
+        read_from_non_mmio_device(data.data(), core, addr, data.size());
+    }
+}
+
+void Cluster::write_segments_to_device(
+    const std::vector<Span<const std::uint8_t>>& segments,
+    tt_cxy_pair core,
+    uint64_t addr,
+    const std::string& fallback_tlb) {
+    SegmentList<const uint8_t> source(segments);
+    TraceScope trace("Write segments to device", TraceCategory::Transfer, core.chip, source.size_bytes());
+    log_assert(fallback_tlb != "REG_TLB", "Segmented writes are not supported through REG_TLB");
+    const LockedGateway gateway = get_transfer_gateway(core.chip, source.size_bytes());
+    if (gateway.get_mmio_chip() == core.chip) {
+        write_device_memory(source, core, addr, fallback_tlb, dynamic_tlb_ordering_modes.at(fallback_tlb));
+    } else {
+        write_to_non_mmio_device(source, core, addr, gateway.get_mmio_chip(), false, {});
+    }
+}
+
+void Cluster::read_segments_from_device(
+    const std::vector<Span<std::uint8_t>>& segments, tt_cxy_pair core, uint64_t addr, const std::string& fallback_tlb) {
+    SegmentList<uint8_t> destination(segments);
+    TraceScope trace("Read segments from device", TraceCategory::Transfer, core.chip, destination.size_bytes());
+    log_assert(fallback_tlb != "REG_TLB", "Segmented reads are not supported through REG_TLB");
+    const LockedGateway gateway = get_transfer_gateway(core.chip, destination.size_bytes());
+    if (gateway.get_mmio_chip() == core.chip) {
+        read_device_memory(destination, core, addr, fallback_tlb);
+    } else {
+        read_from_non_mmio_device(destination, core, addr, gateway.get_mmio_chip(), std::nullopt);
     }
 }
 
+Cluster::LockedGateway Cluster::get_transfer_gateway(chip_id_t chip, uint64_t size_in_bytes) {
+    if (cluster_desc->is_chip_mmio_capable(chip)) {
+        return LockedGateway(chip);
+    }
+    log_assert(
+        (get_soc_descriptor(chip).ethernet_cores).size() > 0 && get_number_of_chips_in_cluster() > 1,
+        "Cannot issue ethernet transfers in a single chip cluster!");
+    return get_remote_transfer_gateway(chip, size_in_bytes);
+}
+
+void Cluster::run_per_gateway_in_parallel(const std::map<chip_id_t, std::function<void()>>& transfers_per_gateway) {
+    std::vector<std::future<void>> transfers = {};
+    for (const auto& [gateway, transfer] : transfers_per_gateway) {
+        transfers.push_back(std::async(std::launch::async, transfer));
+    }
+    // Wait for every transfer before rethrowing, they use the caller's buffers.
+    for (auto& transfer : transfers) {
+        transfer.wait();
+    }
+    for (auto& transfer : transfers) {
+        transfer.get();
+    }
+}
+
+void Cluster::gather_read_from_cluster(
+    void* mem_ptr,
+    const std::set<chip_id_t>& chips,
+    const CoreSet& cores,
+    uint64_t address,
+    uint32_t size_in_bytes,
+    const std::string& fallback_tlb) {
+    uint8_t* buffer_addr = static_cast<uint8_t*>(mem_ptr);
+    const std::size_t chip_stride = cores.size() * size_in_bytes;
+    TraceScope trace("Gather read from cluster", TraceCategory::Transfer, -1, chips.size() * chip_stride);
+
+    // Reads which go through the same MMIO chip are serialized by its TLB and ethernet queue mutexes anyway, so they
+    // are issued from one thread. The gateways are picked up front, so the groups do not change while reading.
+    std::vector<LockedGateway> gateways = {};
+    std::map<chip_id_t, std::vector<std::pair<chip_id_t, std::size_t>>> chips_per_gateway = {};
+    std::size_t chip_offset = 0;
+    for (const chip_id_t chip : chips) {
+        gateways.push_back(get_transfer_gateway(chip, size_in_bytes));
+        chips_per_gateway[gateways.back().get_mmio_chip()].push_back({chip, chip_offset});
+        chip_offset += chip_stride;
+    }
+
+    std::map<chip_id_t, std::function<void()>> reads_per_gateway = {};
+    for (const auto& [gateway, gateway_chips] : chips_per_gateway) {
+        reads_per_gateway[gateway] = [&, gateway = gateway, gateway_chips = &gateway_chips] {
+            for (const auto& [chip, offset] : *gateway_chips) {
+                TraceScope chip_trace("Gather read from chip", TraceCategory::Transfer, chip, chip_stride);
+                std::size_t core_offset = offset;
+                for (const tt_xy_pair& core : cores) {
+                    const tt_cxy_pair target(chip, core);
+                    if (chip != gateway) {
+                        read_from_non_mmio_device(
+                            buffer_addr + core_offset, target, address, size_in_bytes, gateway, std::nullopt);
+                    } else if (fallback_tlb == "REG_TLB") {
+                        read_mmio_device_register(
+                            buffer_addr + core_offset, target, address, size_in_bytes, fallback_tlb);
+                    } else {
+                        read_device_memory(buffer_addr + core_offset, target, address, size_in_bytes, fallback_tlb);
+                    }
+                    core_offset += size_in_bytes;
+                }
+            }
+        };
+    }
+    run_per_gateway_in_parallel(reads_per_gateway);
+}
+
+void* Cluster::read_from_remote_device_to_sysmem(
+    tt_cxy_pair core, uint64_t addr, uint32_t size, uint64_t sysmem_offset) {
+    log_assert(
+        arch_name == tt::ARCH::WORMHOLE_B0 || arch_name == tt::ARCH::BLACKHOLE,
+        "Zero copy remote reads are only supported on Wormhole and Blackhole");
+    log_assert(cluster_desc->is_chip_remote(core.chip), "Zero copy reads are only supported for remote chips");
+    log_assert(
+        (addr & 0x1F) == 0 && (sysmem_offset & 0x1F) == 0 && size % sizeof(uint32_t) == 0,
+        "Zero copy reads require 32 byte aligned addresses and a size which is a multiple of 4 bytes");
+
+    // The read must not move the remote chip to another MMIO chip, since the destination is in its host memory.
+    const LockedGateway gateway = get_remote_transfer_gateway(core.chip, 0);
+    const chip_id_t mmio_chip = gateway.get_mmio_chip();
+    const uint64_t routing_buffers_start = host_address_params.eth_routing_buffers_start;
+    // Every ethernet core used for remote transfers has its own cmd_buf_size routing buffers.
+    const uint64_t routing_buffers_end =
+        routing_buffers_start + uint64_t(remote_transfer_ethernet_cores.at(mmio_chip).size()) *
+                                    eth_interface_params.cmd_buf_size * host_address_params.eth_routing_block_size;
+    log_assert(
+        sysmem_offset + size <= get_host_channel_size(mmio_chip, 0),
+        "Zero copy read destination is outside of host channel 0 of MMIO chip {}",
+        mmio_chip);
+    log_assert(
+        sysmem_offset + size <= routing_buffers_start || sysmem_offset >= routing_buffers_end,
+        "Zero copy read destination overlaps the ethernet routing buffers");
+    void* sysmem_ptr = host_dma_address(sysmem_offset, mmio_chip, 0);
+    log_assert(sysmem_ptr != nullptr, "Host channel 0 of MMIO chip {} is not mapped", mmio_chip);
+
+    TraceScope trace("Read from remote device to sysmem", TraceCategory::Transfer, core.chip, size);
+    read_from_non_mmio_device(sysmem_ptr, core, addr, size, mmio_chip, sysmem_offset);
+    return sysmem_ptr;
+}
+
 int Cluster::arc_msg(
     int logical_device_id,
     uint32_t msg_code,
@@ -3125,6 +3890,35 @@ void Cluster::send_remote_tensix_risc_reset_to_core(
     tt_driver_atomics::sfence();
 }
 
+void Cluster::send_tensix_risc_reset_to_cores(
+    const chip_id_t chip, const CoreSet& cores, const TensixSoftResetOptions& soft_resets) {
+    if (!cluster_desc->is_chip_mmio_capable(chip)) {
+        for (const auto& core : cores) {
+            send_remote_tensix_risc_reset_to_core(tt_cxy_pair(chip, core), soft_resets);
+        }
+        return;
+    }
+    log_assert(
+        m_pci_device_map.find(chip) != m_pci_device_map.end(),
+        "Could not find MMIO mapped device in devices connected over PCIe");
+    CoreSet unicast_cores = cores;
+    if (arch_name == tt::ARCH::GRAYSKULL) {
+        // Tensix rectangles can be reset with a single multicast, the same way the whole grid is reset in
+        // broadcast_pcie_tensix_risc_reset.
+        for (const auto& [start, end] : (cores & workers_per_chip.at(chip)).to_rectangles()) {
+            if (start != end) {
+                pcie_tensix_risc_reset_grid(chip, start, end, soft_resets);
+                unicast_cores -= CoreSet::rectangle(start, end);
+            }
+        }
+    }
+    // Each unicast reset first points the REG TLB at its core with a 64-bit TLB config store, so the writes cannot go
+    // through a 32-bit BAR register batch.
+    for (const auto& core : unicast_cores) {
+        send_tensix_risc_reset_to_core(tt_cxy_pair(chip, core), soft_resets);
+    }
+}
+
 int Cluster::set_remote_power_state(const chip_id_t& chip, tt_DevicePowerState device_state) {
     auto mmio_capable_chip_logical = cluster_desc->get_closest_mmio_capable_chip(chip);
     return remote_arc_msg(
@@ -3251,6 +4045,7 @@ void Cluster::deassert_resets_and_set_power_state() {
                         NULL);
                 }
             }
+            auto phase = startup_profiler.measure("Enable ethernet queues");
             enable_ethernet_queue(30);
         }
         // Set power state to busy
@@ -3304,18 +4099,158 @@ void Cluster::verify_sw_fw_versions(int device_id, std::uint32_t sw_version, std
 
 void Cluster::start_device(const tt_device_params& device_params) {
     if (device_params.init_device) {
-        initialize_pcie_devices();
-        // MT Initial BH - Ethernet firmware not present in Blackhole
-        if (arch_name == tt::ARCH::WORMHOLE_B0) {
-            verify_eth_fw();
+        const std::size_t start_device_phase = startup_profiler.begin("Start device");
+        const std::uint64_t fingerprint = get_session_fingerprint();
+        // Every device takes part in the session, also when it is not resumed, so that the next process can resume it.
+        bool can_resume = !session_records.empty();
+        for (auto& [pci_interface_id, session_record] : session_records) {
+            can_resume = session_record->begin_session(fingerprint) && can_resume;
+        }
+        if (device_params.resume_session && can_resume && !target_remote_chips.empty()) {
+            // Only the memory barrier flags of the MMIO chips can be read back without relying on the ethernet queues
+            // the previous process left behind, so a reset remote chip would go unnoticed.
+            log_info(
+                LogSiliconDriver, "Sessions of clusters with remote chips are not resumed, initializing the devices");
+            can_resume = false;
+        }
+        if (device_params.resume_session && can_resume) {
+            auto phase = startup_profiler.measure("Validate resumed session");
+            can_resume = membar_flags_are_reset();
+        }
+        session_resumed = device_params.resume_session && can_resume;
+
+        if (session_resumed) {
+            log_info(LogSiliconDriver, "Resuming the device session of the previous process");
+            // Only the firmware dependent features have to be picked again, from the version the devices were
+            // initialized with.
+            if (arch_name == tt::ARCH::WORMHOLE_B0) {
+                std::vector<std::uint32_t> fw_versions = {session_records.begin()->second->get_eth_fw_version()};
+                for (const auto& chip : target_devices_in_cluster) {
+                    verify_sw_fw_versions(chip, SW_VERSION, fw_versions);
+                }
+                eth_fw_version = tt_version(fw_versions.at(0));
+            }
+            auto phase = startup_profiler.measure("Set power state");
+            // MT Initial BH - ARC messages not supported in Blackhole
+            if (arch_name != tt::ARCH::BLACKHOLE) {
+                set_power_state(tt_DevicePowerState::BUSY);
+            }
+        } else {
+            initialize_pcie_devices();
+            // MT Initial BH - Ethernet firmware not present in Blackhole
+            if (arch_name == tt::ARCH::WORMHOLE_B0) {
+                auto phase = startup_profiler.measure("Verify ethernet firmware");
+                verify_eth_fw();
+            }
+            {
+                auto phase = startup_profiler.measure("Deassert resets and set power state");
+                deassert_resets_and_set_power_state();
+            }
+            const std::uint32_t packed_eth_fw_version =
+                (eth_fw_version.major << 16) | (eth_fw_version.minor << 12) | eth_fw_version.patch;
+            for (auto& [pci_interface_id, session_record] : session_records) {
+                session_record->record_configuration(fingerprint, packed_eth_fw_version);
+            }
+        }
+        startup_profiler.end(start_device_phase);
+        log_startup_phases("Device start");
+    }
+}
+
+bool Cluster::is_session_resumed() const { return session_resumed; }
+
+std::uint64_t Cluster::get_session_fingerprint() {
+    ConfigFingerprint fingerprint;
+    fingerprint.add(SW_VERSION).add(static_cast<std::uint64_t>(arch_name));
+    fingerprint.add(l1_address_params.tensix_l1_barrier_base)
+        .add(l1_address_params.eth_l1_barrier_base)
+        .add(dram_address_params.DRAM_BARRIER_BASE);
+    for (const chip_id_t chip : target_devices_in_cluster) {
+        fingerprint.add(chip).add(cluster_desc->get_closest_mmio_capable_chip(chip));
+    }
+    // The iATUs point the devices at the physical addresses of their hugepages.
+    for (const auto& [chip, pci_device] : m_pci_device_map) {
+        fingerprint.add(chip).add(pci_device->get_device_num()).add(pci_device->get_num_host_mem_channels());
+        for (int channel = 0; channel < pci_device->get_num_host_mem_channels(); channel++) {
+            const hugepage_mapping mapping = pci_device->get_hugepage_mapping(channel);
+            fingerprint.add(mapping.physical_address).add(mapping.mapping_size);
         }
-        deassert_resets_and_set_power_state();
+    }
+    return fingerprint.get();
+}
+
+bool Cluster::membar_flags_are_reset() {
+    // A device reset clears L1 and DRAM, so the flags init_membars left behind tell whether the initialization
+    // survived since the previous process.
+    for (const auto& [chip, pci_device] : m_pci_device_map) {
+        std::vector<std::pair<tt_xy_pair, std::uint32_t>> flags = {};
+        if (!workers_per_chip.at(chip).empty()) {
+            flags.push_back({*workers_per_chip.at(chip).begin(), l1_address_params.tensix_l1_barrier_base});
+        }
+        if (!dram_cores.empty()) {
+            flags.push_back({*dram_cores.begin(), dram_address_params.DRAM_BARRIER_BASE});
+        }
+        for (const auto& [core, address] : flags) {
+            std::uint32_t flag = 0;
+            read_device_memory(&flag, tt_cxy_pair(chip, core), address, sizeof(flag), "LARGE_READ_TLB");
+            if (flag != tt_MemBarFlag::RESET) {
+                log_info(
+                    LogSiliconDriver,
+                    "Memory barrier flag of chip {} core {} was not kept, initializing the device again",
+                    chip,
+                    core.str());
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+const std::vector<PhaseTiming>& Cluster::get_startup_phases() const { return startup_profiler.get_phases(); }
+
+void Cluster::enable_tracing(const std::string& trace_file_path) {
+    DriverTrace::start(trace_file_path);
+    owns_trace = true;
+    log_info(LogSiliconDriver, "Tracing driver activity to {}", trace_file_path);
+}
+
+std::vector<LockStats> Cluster::get_lock_stats(chip_id_t mmio_chip) {
+    return lock_stats_tables.at(get_pci_device(mmio_chip)->get_device_num())->read();
+}
+
+void Cluster::reset_lock_stats(chip_id_t mmio_chip) {
+    lock_stats_tables.at(get_pci_device(mmio_chip)->get_device_num())->reset();
+}
+
+void Cluster::disable_tracing() {
+    if (!owns_trace) {
+        return;
+    }
+    const std::uint64_t dropped_events = DriverTrace::get_dropped_events();
+    DriverTrace::stop();
+    owns_trace = false;
+    if (dropped_events > 0) {
+        log_warning(LogSiliconDriver, "Dropped {} trace events, the trace buffers were full", dropped_events);
+    }
+}
+
+void Cluster::log_startup_phases(const std::string& stage) {
+    const std::string summary = startup_profiler.summary();
+    if (std::getenv("TT_UMD_PROFILE_STARTUP")) {
+        log_info(LogSiliconDriver, "{} phases:\n{}", stage, summary);
+    } else {
+        log_debug(LogSiliconDriver, "{} phases:\n{}", stage, summary);
     }
 }
 
 void Cluster::close_device() {
     set_power_state(tt_DevicePowerState::LONG_IDLE);
     broadcast_tensix_risc_reset_to_cluster(TENSIX_ASSERT_SOFT_RESET);
+    clear_host_memory_registrations();
+    // The devices are left as start_device expects to find them when resuming.
+    for (auto& [pci_interface_id, session_record] : session_records) {
+        session_record->end_session(true);
+    }
 }
 
 void Cluster::set_device_l1_address_params(const tt_device_l1_address_params& l1_address_params_) {
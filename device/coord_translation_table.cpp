@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/coord_translation_table.h"
+
+#include <algorithm>
+
+#include "logger.hpp"
+
+namespace tt::umd {
+
+CoordTranslationTable::CoordTranslationTable(
+    const std::unordered_map<tt_xy_pair, tt_xy_pair>& translation, bool noc_translation_enabled) :
+    noc_translation_enabled(noc_translation_enabled) {
+    for (const auto& [core, _] : translation) {
+        grid_size.x = std::max(grid_size.x, core.x + 1);
+        grid_size.y = std::max(grid_size.y, core.y + 1);
+    }
+    log_assert(
+        translation.size() == grid_size.x * grid_size.y,
+        "Coordinate translation has {} entries, expected a full {}x{} grid.",
+        translation.size(),
+        grid_size.x,
+        grid_size.y);
+
+    table.resize(grid_size.x * grid_size.y);
+    for (const auto& [core, translated_core] : translation) {
+        table[core.y * grid_size.x + core.x] = translated_core;
+    }
+}
+
+std::unordered_map<tt_xy_pair, tt_xy_pair> CoordTranslationTable::to_map() const {
+    std::unordered_map<tt_xy_pair, tt_xy_pair> translation = {};
+    for (std::size_t y = 0; y < grid_size.y; y++) {
+        for (std::size_t x = 0; x < grid_size.x; x++) {
+            translation.insert({tt_xy_pair(x, y), table[y * grid_size.x + x]});
+        }
+    }
+    return translation;
+}
+
+}  // namespace tt::umd
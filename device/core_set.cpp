@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/core_set.h"
+
+namespace tt::umd {
+
+CoreSet::CoreSet(std::initializer_list<tt_xy_pair> cores) {
+    for (const auto& core : cores) {
+        insert(core);
+    }
+}
+
+CoreSet::CoreSet(const std::vector<tt_xy_pair>& cores) {
+    for (const auto& core : cores) {
+        insert(core);
+    }
+}
+
+CoreSet::CoreSet(const std::unordered_set<tt_xy_pair>& cores) {
+    for (const auto& core : cores) {
+        insert(core);
+    }
+}
+
+CoreSet CoreSet::rectangle(const tt_xy_pair& start, const tt_xy_pair& end) {
+    check_in_range(end);
+    if (start.x > end.x || start.y > end.y) {
+        throw std::invalid_argument("Rectangle start " + start.str() + " is past its end " + end.str() + ".");
+    }
+    CoreSet set;
+    const std::uint64_t span = row_span(start.x, end.x);
+    for (std::size_t y = start.y; y <= end.y; y++) {
+        set.rows[y] = span;
+    }
+    return set;
+}
+
+std::size_t CoreSet::size() const {
+    std::size_t count = 0;
+    for (const auto row : rows) {
+        count += __builtin_popcountll(row);
+    }
+    return count;
+}
+
+bool CoreSet::empty() const {
+    for (const auto row : rows) {
+        if (row) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CoreSet::is_subset_of(const CoreSet& other) const {
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        if (rows[y] & ~other.rows[y]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+CoreSet& CoreSet::operator|=(const CoreSet& other) {
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        rows[y] |= other.rows[y];
+    }
+    return *this;
+}
+
+CoreSet& CoreSet::operator&=(const CoreSet& other) {
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        rows[y] &= other.rows[y];
+    }
+    return *this;
+}
+
+CoreSet& CoreSet::operator-=(const CoreSet& other) {
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        rows[y] &= ~other.rows[y];
+    }
+    return *this;
+}
+
+std::vector<std::pair<tt_xy_pair, tt_xy_pair>> CoreSet::to_rectangles() const {
+    std::vector<std::pair<tt_xy_pair, tt_xy_pair>> rectangles = {};
+    auto remaining = rows;
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        while (remaining[y]) {
+            const std::size_t start_x = __builtin_ctzll(remaining[y]);
+            // Length of the run of set bits starting at start_x.
+            const std::uint64_t unset_after_start = ~(remaining[y] >> start_x);
+            const std::size_t run_length =
+                unset_after_start ? __builtin_ctzll(unset_after_start) : MAX_GRID_DIM - start_x;
+            const std::size_t end_x = start_x + run_length - 1;
+            const std::uint64_t span = row_span(start_x, end_x);
+
+            std::size_t end_y = y;
+            while (end_y + 1 < MAX_GRID_DIM && (remaining[end_y + 1] & span) == span) {
+                end_y++;
+            }
+            for (std::size_t row = y; row <= end_y; row++) {
+                remaining[row] &= ~span;
+            }
+            rectangles.push_back({tt_xy_pair(start_x, y), tt_xy_pair(end_x, end_y)});
+        }
+    }
+    return rectangles;
+}
+
+std::optional<std::pair<std::uint64_t, std::uint64_t>> CoreSet::to_rows_and_columns() const {
+    std::uint64_t row_mask = 0;
+    std::uint64_t column_mask = 0;
+    for (std::size_t y = 0; y < MAX_GRID_DIM; y++) {
+        if (rows[y] == 0) {
+            continue;
+        }
+        // Every non empty row has to hold the same columns.
+        if (row_mask != 0 && rows[y] != column_mask) {
+            return std::nullopt;
+        }
+        row_mask |= bit(y);
+        column_mask = rows[y];
+    }
+    if (row_mask == 0) {
+        return std::nullopt;
+    }
+    return std::make_pair(row_mask, column_mask);
+}
+
+std::unordered_set<tt_xy_pair> CoreSet::to_unordered_set() const {
+    std::unordered_set<tt_xy_pair> cores = {};
+    for (const auto& core : *this) {
+        cores.insert(core);
+    }
+    return cores;
+}
+
+}  // namespace tt::umd
@@ -464,6 +464,26 @@ bool tt_cpuset_allocator::bind_area_memory_nodeset(chip_id_t physical_device_id,
     return true;  // Success
 }
 
+bool tt_cpuset_allocator::area_on_memory_nodeset(chip_id_t physical_device_id, const void *addr, size_t len) {
+    auto target_nodeset_it = m_physical_device_id_to_numa_nodeset_map.find(physical_device_id);
+    if (target_nodeset_it == m_physical_device_id_to_numa_nodeset_map.end() || target_nodeset_it->second == 0) {
+        return false;
+    }
+
+    hwloc_nodeset_t area_nodeset = hwloc_bitmap_alloc();
+    bool on_target_nodeset =
+        hwloc_get_area_memlocation(m_topology, addr, len, area_nodeset, HWLOC_MEMBIND_BYNODESET) == 0 &&
+        !hwloc_bitmap_iszero(area_nodeset) && hwloc_bitmap_isincluded(area_nodeset, target_nodeset_it->second);
+    log_debug(
+        LogSiliconDriver,
+        "area_on_memory_nodeset(): memory of physical_device_id: {} is on NodeSet: {}, target NodeSet: {}",
+        physical_device_id,
+        get_hwloc_bitmap_vector(area_nodeset),
+        get_hwloc_bitmap_vector(target_nodeset_it->second));
+    hwloc_bitmap_free(area_nodeset);
+    return on_target_nodeset;
+}
+
 int tt_cpuset_allocator::_get_num_tt_pci_devices() {
     for (auto &d : m_physical_device_id_to_package_id_map) {
         log_trace(LogSiliconDriver, "Found physical_device_id: {} ", d.first);
@@ -36,6 +36,12 @@ public:
         return instance.bind_area_memory_nodeset(physical_device_id, addr, len);
     }
 
+    // Whether all pages of an already allocated memory region are on the numa nodes closest to the device
+    static bool is_area_on_memory_nodeset(chip_id_t physical_device_id, const void *addr, size_t len) {
+        auto &instance = tt_cpuset_allocator::get();
+        return instance.area_on_memory_nodeset(physical_device_id, addr, len);
+    }
+
     static int get_num_tt_pci_devices() {
         auto &instance = tt_cpuset_allocator::get();
         return instance._get_num_tt_pci_devices();
@@ -57,6 +63,7 @@ private:
     int TENSTORRENT_VENDOR_ID = 0x1e52;
 
     bool bind_area_memory_nodeset(chip_id_t physical_device_id, const void *addr, size_t len);
+    bool area_on_memory_nodeset(chip_id_t physical_device_id, const void *addr, size_t len);
     int _get_num_tt_pci_devices();
     int _get_num_tt_pci_devices_by_pci_device_id(uint16_t device_id, uint16_t revision_id);
 
@@ -0,0 +1,325 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/driver_trace.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "fmt/core.h"
+
+namespace tt::umd {
+
+namespace {
+
+// Chip tracks are shown as processes of their own. Their ids start above the largest pid Linux hands out, so they
+// do not collide with the host process.
+constexpr std::int64_t CHIP_TRACK_PID_BASE = 1 << 22;
+
+struct ThreadTrace {
+    ThreadTrace(std::size_t ring_capacity, std::int64_t tid) : ring(ring_capacity), tid(tid) {}
+
+    TraceRing ring;
+    std::int64_t tid;
+};
+
+struct TraceSession {
+    std::uint64_t generation = 0;
+    std::size_t ring_capacity = 0;
+    std::chrono::milliseconds flush_interval = {};
+    std::uint64_t start_ns = 0;
+    std::int64_t pid = 0;
+
+    // Rings of all threads which recorded events, taken when a thread records its first event.
+    std::mutex threads_mutex;
+    std::vector<std::shared_ptr<ThreadTrace>> threads;
+
+    // Only touched by whoever drains the rings, which is the flush thread until stop joins it.
+    std::ofstream file;
+    bool first_event = true;
+    std::set<std::int64_t> named_threads;
+    std::set<std::pair<std::int32_t, std::int64_t>> named_chip_threads;
+
+    std::thread flush_thread;
+    std::mutex stop_mutex;
+    std::condition_variable stop_condition;
+    bool stopping = false;
+};
+
+std::mutex session_mutex;
+std::shared_ptr<TraceSession> current_session;
+// Generation of current_session, or 0 if there is none. Lets threads check their ring without touching the session.
+std::atomic<std::uint64_t> current_generation = 0;
+std::uint64_t last_generation = 0;
+
+thread_local std::shared_ptr<ThreadTrace> thread_trace;
+thread_local std::uint64_t thread_trace_generation = 0;
+
+void write_json_event(TraceSession& session, const std::string& json) {
+    session.file << (session.first_event ? "\n" : ",\n") << json;
+    session.first_event = false;
+}
+
+void write_thread_name(TraceSession& session, std::int64_t pid, std::int64_t tid) {
+    write_json_event(
+        session,
+        fmt::format(
+            R"({{"ph":"M","name":"thread_name","pid":{},"tid":{},"args":{{"name":"Thread {}"}}}})", pid, tid, tid));
+}
+
+std::string format_event_args(const TraceEvent& event) {
+    std::string args = "";
+    if (event.chip >= 0) {
+        args += fmt::format(R"("chip":{})", event.chip);
+    }
+    if (event.arg != 0) {
+        if (!args.empty()) {
+            args += ",";
+        }
+        switch (event.category) {
+            case TraceCategory::Transfer:
+                args += fmt::format(R"("bytes":{})", event.arg);
+                break;
+            case TraceCategory::ArcMessage:
+                args += fmt::format(R"("msg_code":"0x{:x}")", event.arg);
+                break;
+            default:
+                args += fmt::format(R"("address":"0x{:x}")", event.arg);
+                break;
+        }
+    }
+    return args;
+}
+
+void write_event(TraceSession& session, const TraceEvent& event, std::int64_t tid) {
+    const double ts_us =
+        event.start_ns > session.start_ns ? static_cast<double>(event.start_ns - session.start_ns) / 1000 : 0.0;
+    const double dur_us = static_cast<double>(event.duration_ns) / 1000;
+    const std::string args = format_event_args(event);
+
+    if (session.named_threads.insert(tid).second) {
+        write_thread_name(session, session.pid, tid);
+    }
+    write_json_event(
+        session,
+        fmt::format(
+            R"({{"ph":"X","name":"{}","cat":"{}","pid":{},"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{{}}}}})",
+            event.name,
+            trace_category_name(event.category),
+            session.pid,
+            tid,
+            ts_us,
+            dur_us,
+            args));
+
+    if (event.chip < 0) {
+        return;
+    }
+    // On the chip track every thread gets its own row, so that the events of a row stay properly nested.
+    const std::int64_t chip_pid = CHIP_TRACK_PID_BASE + event.chip;
+    if (session.named_chip_threads.insert({event.chip, tid}).second) {
+        write_json_event(
+            session,
+            fmt::format(
+                R"({{"ph":"M","name":"process_name","pid":{},"tid":0,"args":{{"name":"Chip {}"}}}})",
+                chip_pid,
+                event.chip));
+        write_thread_name(session, chip_pid, tid);
+    }
+    write_json_event(
+        session,
+        fmt::format(
+            R"({{"ph":"X","name":"{}","cat":"{}","pid":{},"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{{}}}}})",
+            event.name,
+            trace_category_name(event.category),
+            chip_pid,
+            tid,
+            ts_us,
+            dur_us,
+            args));
+}
+
+void flush_session(TraceSession& session) {
+    std::vector<std::shared_ptr<ThreadTrace>> threads;
+    {
+        std::lock_guard<std::mutex> lock(session.threads_mutex);
+        threads = session.threads;
+    }
+    std::vector<TraceEvent> events = {};
+    for (const auto& thread : threads) {
+        events.clear();
+        thread->ring.drain(events);
+        for (const auto& event : events) {
+            write_event(session, event, thread->tid);
+        }
+    }
+    session.file.flush();
+}
+
+void run_flush_thread(TraceSession* session) {
+    std::unique_lock<std::mutex> lock(session->stop_mutex);
+    while (!session->stopping) {
+        session->stop_condition.wait_for(lock, session->flush_interval);
+        lock.unlock();
+        flush_session(*session);
+        lock.lock();
+    }
+}
+
+ThreadTrace* get_thread_trace() {
+    if (thread_trace != nullptr && thread_trace_generation == current_generation.load(std::memory_order_acquire)) {
+        return thread_trace.get();
+    }
+
+    // First event of this thread in the current trace.
+    std::shared_ptr<TraceSession> session = std::atomic_load(&current_session);
+    if (session == nullptr) {
+        return nullptr;
+    }
+    const std::int64_t tid = syscall(SYS_gettid);
+    thread_trace = std::make_shared<ThreadTrace>(session->ring_capacity, tid);
+    thread_trace_generation = session->generation;
+    std::lock_guard<std::mutex> lock(session->threads_mutex);
+    session->threads.push_back(thread_trace);
+    return thread_trace.get();
+}
+
+}  // namespace
+
+const char* trace_category_name(TraceCategory category) {
+    switch (category) {
+        case TraceCategory::Transfer:
+            return "transfer";
+        case TraceCategory::TlbReprogram:
+            return "tlb";
+        case TraceCategory::MutexWait:
+            return "mutex";
+        case TraceCategory::EthernetQueueFull:
+            return "eth_queue";
+        case TraceCategory::Membar:
+            return "membar";
+        case TraceCategory::ArcMessage:
+            return "arc";
+    }
+    return "unknown";
+}
+
+TraceRing::TraceRing(std::size_t capacity) {
+    std::size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    events.resize(size);
+    mask = size - 1;
+}
+
+bool TraceRing::push(const TraceEvent& event) {
+    const std::uint64_t current_head = head.load(std::memory_order_relaxed);
+    if (current_head - tail.load(std::memory_order_acquire) >= events.size()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    events[current_head & mask] = event;
+    head.store(current_head + 1, std::memory_order_release);
+    return true;
+}
+
+std::size_t TraceRing::drain(std::vector<TraceEvent>& drained) {
+    const std::uint64_t current_tail = tail.load(std::memory_order_relaxed);
+    const std::uint64_t current_head = head.load(std::memory_order_acquire);
+    for (std::uint64_t i = current_tail; i < current_head; i++) {
+        drained.push_back(events[i & mask]);
+    }
+    tail.store(current_head, std::memory_order_release);
+    return current_head - current_tail;
+}
+
+std::atomic<bool> DriverTrace::enabled = false;
+
+void DriverTrace::start(
+    const std::string& trace_file_path, std::size_t ring_capacity, std::chrono::milliseconds flush_interval) {
+    std::lock_guard<std::mutex> lock(session_mutex);
+    if (current_session != nullptr) {
+        throw std::runtime_error(
+            fmt::format("Cannot trace to {}, a trace is already being recorded.", trace_file_path));
+    }
+
+    auto session = std::make_shared<TraceSession>();
+    session->file.open(trace_file_path, std::ios::out | std::ios::trunc);
+    if (!session->file.is_open()) {
+        throw std::runtime_error(fmt::format("Failed to open trace file {}.", trace_file_path));
+    }
+    session->generation = ++last_generation;
+    session->ring_capacity = ring_capacity;
+    session->flush_interval = flush_interval;
+    session->start_ns = now_ns();
+    session->pid = getpid();
+
+    session->file << R"({"displayTimeUnit":"ns","traceEvents":[)";
+    write_json_event(
+        *session,
+        fmt::format(
+            R"({{"ph":"M","name":"process_name","pid":{},"tid":0,"args":{{"name":"Host"}}}})", session->pid));
+    session->flush_thread = std::thread(run_flush_thread, session.get());
+
+    std::atomic_store(&current_session, session);
+    current_generation.store(session->generation, std::memory_order_release);
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void DriverTrace::stop() {
+    std::lock_guard<std::mutex> lock(session_mutex);
+    std::shared_ptr<TraceSession> session = std::atomic_exchange(&current_session, std::shared_ptr<TraceSession>());
+    if (session == nullptr) {
+        return;
+    }
+    enabled.store(false, std::memory_order_relaxed);
+    current_generation.store(0, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> stop_lock(session->stop_mutex);
+        session->stopping = true;
+    }
+    session->stop_condition.notify_all();
+    session->flush_thread.join();
+
+    flush_session(*session);
+    session->file << "\n]}\n";
+    session->file.close();
+}
+
+std::uint64_t DriverTrace::get_dropped_events() {
+    std::shared_ptr<TraceSession> session = std::atomic_load(&current_session);
+    if (session == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(session->threads_mutex);
+    std::uint64_t dropped = 0;
+    for (const auto& thread : session->threads) {
+        dropped += thread->ring.get_dropped();
+    }
+    return dropped;
+}
+
+void DriverTrace::record(const TraceEvent& event) {
+    if (!is_enabled()) {
+        return;
+    }
+    ThreadTrace* trace = get_thread_trace();
+    if (trace != nullptr) {
+        trace->ring.push(event);
+    }
+}
+
+}  // namespace tt::umd
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/host_memory_registration_cache.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "fmt/core.h"
+
+namespace tt::umd {
+
+HostMemoryRegistrationCache::HostMemoryRegistrationCache(std::vector<std::uint32_t> windows) :
+    free_windows(std::move(windows)) {}
+
+std::optional<HostMemoryRegistration> HostMemoryRegistrationCache::acquire(std::uintptr_t address, std::size_t size) {
+    for (auto& registration : registrations) {
+        if (address >= registration.start && address + size <= registration.start + registration.size) {
+            registration.users++;
+            registration.last_use = ++use_counter;
+            return registration;
+        }
+    }
+    return std::nullopt;
+}
+
+std::uint32_t HostMemoryRegistrationCache::allocate_window(std::optional<HostMemoryRegistration>& evicted) {
+    evicted.reset();
+    if (!free_windows.empty()) {
+        const std::uint32_t window = free_windows.back();
+        free_windows.pop_back();
+        return window;
+    }
+
+    auto least_recently_used = registrations.end();
+    for (auto it = registrations.begin(); it != registrations.end(); it++) {
+        if (it->users == 0 &&
+            (least_recently_used == registrations.end() || it->last_use < least_recently_used->last_use)) {
+            least_recently_used = it;
+        }
+    }
+    if (least_recently_used == registrations.end()) {
+        throw std::runtime_error(fmt::format(
+            "All {} host memory windows are used by registrations which have not been released.",
+            registrations.size()));
+    }
+    evicted = *least_recently_used;
+    registrations.erase(least_recently_used);
+    return evicted->window;
+}
+
+void HostMemoryRegistrationCache::insert(HostMemoryRegistration registration) {
+    registration.users = 1;
+    registration.last_use = ++use_counter;
+    registrations.push_back(registration);
+}
+
+void HostMemoryRegistrationCache::release(std::uintptr_t address) {
+    for (auto& registration : registrations) {
+        if (address >= registration.start && address < registration.start + registration.size) {
+            if (registration.users > 0) {
+                registration.users--;
+            }
+            return;
+        }
+    }
+    throw std::invalid_argument(fmt::format("Host memory at 0x{:x} is not registered.", address));
+}
+
+std::vector<HostMemoryRegistration> HostMemoryRegistrationCache::invalidate(std::uintptr_t address, std::size_t size) {
+    auto overlaps = [&](const HostMemoryRegistration& registration) {
+        return address < registration.start + registration.size && registration.start < address + size;
+    };
+    for (const auto& registration : registrations) {
+        if (overlaps(registration) && registration.users > 0) {
+            throw std::runtime_error(fmt::format(
+                "Host memory at 0x{:x} is still in use by {} registrations.", registration.start, registration.users));
+        }
+    }
+
+    std::vector<HostMemoryRegistration> invalidated = {};
+    auto first_invalidated = std::stable_partition(
+        registrations.begin(), registrations.end(), [&](const auto& registration) { return !overlaps(registration); });
+    for (auto it = first_invalidated; it != registrations.end(); it++) {
+        free_windows.push_back(it->window);
+        invalidated.push_back(*it);
+    }
+    registrations.erase(first_invalidated, registrations.end());
+    return invalidated;
+}
+
+std::vector<HostMemoryRegistration> HostMemoryRegistrationCache::clear() {
+    std::vector<HostMemoryRegistration> cleared = std::move(registrations);
+    registrations.clear();
+    for (const auto& registration : cleared) {
+        free_windows.push_back(registration.window);
+    }
+    return cleared;
+}
+
+}  // namespace tt::umd
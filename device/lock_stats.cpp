@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/lock_stats.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/permissions.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/sync/named_mutex.hpp>
+#include <cstring>
+#include <stdexcept>
+
+#include "fmt/core.h"
+
+using namespace boost::interprocess;
+
+namespace tt::umd {
+
+// Layout of a table entry in shared memory. Zero filled memory is a valid free slot.
+struct LockStatsSlot {
+    static constexpr std::uint32_t FREE = 0;
+    static constexpr std::uint32_t CLAIMING = 1;
+    static constexpr std::uint32_t READY = 2;
+
+    std::atomic<std::uint32_t> state;
+    char name[LockStatsTable::MAX_LOCK_NAME_LENGTH + 1];
+    std::atomic<std::uint64_t> acquisitions;
+    std::atomic<std::uint64_t> contended_acquisitions;
+    std::atomic<std::uint64_t> total_wait_ns;
+    std::atomic<std::uint64_t> max_wait_ns;
+    std::atomic<std::uint64_t> total_hold_ns;
+    std::atomic<std::uint64_t> max_hold_ns;
+    std::atomic<std::int32_t> holder_pid;
+    std::atomic<std::int32_t> holder_tid;
+    std::atomic<std::uint64_t> hold_start_ns;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Lock stats are shared between processes");
+
+namespace {
+
+constexpr std::size_t TABLE_SIZE = sizeof(LockStatsSlot) * LockStatsTable::MAX_LOCKS;
+
+// CLOCK_MONOTONIC is system wide, so the timestamps of different processes can be compared.
+std::uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void update_max(std::atomic<std::uint64_t>& max, std::uint64_t value) {
+    std::uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<LockStats> read_slots(const LockStatsSlot* slots) {
+    const std::uint64_t now = now_ns();
+    std::vector<LockStats> all_stats = {};
+    for (std::size_t i = 0; i < LockStatsTable::MAX_LOCKS; i++) {
+        const LockStatsSlot& slot = slots[i];
+        if (slot.state.load(std::memory_order_acquire) != LockStatsSlot::READY) {
+            continue;
+        }
+        LockStats stats;
+        stats.name = std::string(slot.name, strnlen(slot.name, sizeof(slot.name)));
+        stats.acquisitions = slot.acquisitions.load(std::memory_order_relaxed);
+        stats.contended_acquisitions = slot.contended_acquisitions.load(std::memory_order_relaxed);
+        stats.total_wait = std::chrono::nanoseconds(slot.total_wait_ns.load(std::memory_order_relaxed));
+        stats.max_wait = std::chrono::nanoseconds(slot.max_wait_ns.load(std::memory_order_relaxed));
+        stats.total_hold = std::chrono::nanoseconds(slot.total_hold_ns.load(std::memory_order_relaxed));
+        stats.max_hold = std::chrono::nanoseconds(slot.max_hold_ns.load(std::memory_order_relaxed));
+        stats.holder_pid = slot.holder_pid.load(std::memory_order_relaxed);
+        stats.holder_tid = slot.holder_tid.load(std::memory_order_relaxed);
+        const std::uint64_t hold_start = slot.hold_start_ns.load(std::memory_order_relaxed);
+        if (stats.holder_pid != 0 && now > hold_start) {
+            stats.current_hold = std::chrono::nanoseconds(now - hold_start);
+        }
+        all_stats.push_back(stats);
+    }
+    return all_stats;
+}
+
+}  // namespace
+
+LockStatsTable::LockStatsTable(int pci_interface_id) {
+    permissions unrestricted_permissions;
+    unrestricted_permissions.set_unrestricted();
+    shared_memory_object shm(
+        open_or_create, get_shared_memory_name(pci_interface_id).c_str(), read_write, unrestricted_permissions);
+    offset_t size = 0;
+    if (!shm.get_size(size) || size < static_cast<offset_t>(TABLE_SIZE)) {
+        // Extending the object fills it with zeros, so a concurrent creator truncating it as well does no harm.
+        shm.truncate(TABLE_SIZE);
+    }
+    region = std::make_unique<mapped_region>(shm, read_write, 0, TABLE_SIZE);
+    slots = static_cast<LockStatsSlot*>(region->get_address());
+}
+
+LockStatsTable::~LockStatsTable() = default;
+
+std::string LockStatsTable::get_shared_memory_name(int pci_interface_id) {
+    return fmt::format("TT_UMD_LOCK_STATS{}", pci_interface_id);
+}
+
+void LockStatsTable::remove(int pci_interface_id) {
+    shared_memory_object::remove(get_shared_memory_name(pci_interface_id).c_str());
+}
+
+LockStatsSlot* LockStatsTable::get_slot(const std::string& name) {
+    if (name.size() > MAX_LOCK_NAME_LENGTH) {
+        throw std::runtime_error(fmt::format("Lock name {} is too long for the lock stats table.", name));
+    }
+    for (std::size_t i = 0; i < MAX_LOCKS; i++) {
+        LockStatsSlot& slot = slots[i];
+        std::uint32_t state = slot.state.load(std::memory_order_acquire);
+        if (state == LockStatsSlot::FREE &&
+            slot.state.compare_exchange_strong(state, LockStatsSlot::CLAIMING, std::memory_order_acquire)) {
+            std::strncpy(slot.name, name.c_str(), sizeof(slot.name));
+            slot.state.store(LockStatsSlot::READY, std::memory_order_release);
+            return &slot;
+        }
+        // Another process is naming the slot, it could be for the same mutex.
+        while (state == LockStatsSlot::CLAIMING) {
+            state = slot.state.load(std::memory_order_acquire);
+        }
+        if (std::strncmp(slot.name, name.c_str(), sizeof(slot.name)) == 0) {
+            return &slot;
+        }
+    }
+    throw std::runtime_error(fmt::format("No free slot for lock {} in the lock stats table.", name));
+}
+
+std::vector<LockStats> LockStatsTable::read() const { return read_slots(slots); }
+
+void LockStatsTable::reset() {
+    for (std::size_t i = 0; i < MAX_LOCKS; i++) {
+        LockStatsSlot& slot = slots[i];
+        slot.acquisitions = 0;
+        slot.contended_acquisitions = 0;
+        slot.total_wait_ns = 0;
+        slot.max_wait_ns = 0;
+        slot.total_hold_ns = 0;
+        slot.max_hold_ns = 0;
+    }
+}
+
+std::vector<LockStats> read_lock_stats(int pci_interface_id) {
+    try {
+        shared_memory_object shm(
+            open_only, LockStatsTable::get_shared_memory_name(pci_interface_id).c_str(), read_only);
+        offset_t size = 0;
+        if (!shm.get_size(size) || size < static_cast<offset_t>(TABLE_SIZE)) {
+            return {};
+        }
+        mapped_region region(shm, read_only, 0, TABLE_SIZE);
+        return read_slots(static_cast<const LockStatsSlot*>(region.get_address()));
+    } catch (const interprocess_exception&) {
+        return {};
+    }
+}
+
+ProfiledNamedMutex::ProfiledNamedMutex(std::unique_ptr<named_mutex> mutex, LockStatsSlot* stats) :
+    mutex(std::move(mutex)), stats(stats) {}
+
+ProfiledNamedMutex::~ProfiledNamedMutex() = default;
+
+void ProfiledNamedMutex::lock() {
+    const std::uint64_t start = now_ns();
+    if (mutex->try_lock()) {
+        record_acquisition(now_ns() - start, false);
+        return;
+    }
+    mutex->lock();
+    record_acquisition(now_ns() - start, true);
+}
+
+bool ProfiledNamedMutex::try_lock() {
+    const std::uint64_t start = now_ns();
+    if (!mutex->try_lock()) {
+        return false;
+    }
+    record_acquisition(now_ns() - start, false);
+    return true;
+}
+
+void ProfiledNamedMutex::unlock() {
+    const std::uint64_t hold_ns = now_ns() - stats->hold_start_ns.load(std::memory_order_relaxed);
+    stats->total_hold_ns.fetch_add(hold_ns, std::memory_order_relaxed);
+    update_max(stats->max_hold_ns, hold_ns);
+    stats->holder_pid.store(0, std::memory_order_relaxed);
+    stats->holder_tid.store(0, std::memory_order_relaxed);
+    mutex->unlock();
+}
+
+void ProfiledNamedMutex::record_acquisition(std::uint64_t wait_ns, bool contended) {
+    stats->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (contended) {
+        stats->contended_acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+    stats->total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    update_max(stats->max_wait_ns, wait_ns);
+    stats->holder_pid.store(getpid(), std::memory_order_relaxed);
+    stats->holder_tid.store(syscall(SYS_gettid), std::memory_order_relaxed);
+    stats->hold_start_ns.store(now_ns(), std::memory_order_relaxed);
+}
+
+}  // namespace tt::umd
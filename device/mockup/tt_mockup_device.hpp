@@ -65,9 +65,7 @@ public:
         void* mem_ptr, uint64_t addr, uint16_t channel, uint32_t size, chip_id_t src_device_id) override {}
 
     void l1_membar(
-        const chip_id_t chip,
-        const std::string& fallback_tlb,
-        const std::unordered_set<tt_xy_pair>& cores = {}) override {}
+        const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {}) override {}
 
     void dram_membar(
         const chip_id_t chip,
@@ -75,9 +73,7 @@ public:
         const std::unordered_set<uint32_t>& channels = {}) override {}
 
     void dram_membar(
-        const chip_id_t chip,
-        const std::string& fallback_tlb,
-        const std::unordered_set<tt_xy_pair>& cores = {}) override {}
+        const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores = {}) override {}
 
     void wait_for_non_mmio_flush() override {}
 
@@ -15,6 +15,7 @@
 
 #include <cstdint>
 #include <cstring>  // for memcpy
+#include <future>
 #include <vector>
 
 #include "assert.hpp"
@@ -208,6 +209,97 @@ inline void memcpy_from_device(void *dest, const void *src, std::size_t num_byte
     }
 }
 
+static const std::size_t STREAMING_READ_CHUNK_SIZE = 64;
+static const std::size_t STREAMING_READ_ALIGNMENT = 16;
+
+// Reads from write-combined BAR mappings bypass the cache, so ordinary loads are issued one at a time and each one
+// waits for a full PCIe round trip. Wide loads let the CPU fetch a whole 64-byte chunk per round trip instead.
+//
+// x86: MOVNTDQA (SSE4.1) on WC memory fills a streaming load buffer with the full line on the first access, and the
+// following loads from the same line are served from it.
+// AARCH64: device memory does not allow pair loads (see memcpy_from_device), so use single 64-bit loads, which are
+// still twice as wide as the word copy.
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("sse4.1"))) static void stream_chunks_from_device(
+    void *dest, const void *src, std::size_t num_chunks) {
+    __m128i *sp = reinterpret_cast<__m128i *>(const_cast<void *>(src));
+    __m128i *dp = static_cast<__m128i *>(dest);
+
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        __m128i v0 = _mm_stream_load_si128(sp + 0);
+        __m128i v1 = _mm_stream_load_si128(sp + 1);
+        __m128i v2 = _mm_stream_load_si128(sp + 2);
+        __m128i v3 = _mm_stream_load_si128(sp + 3);
+        _mm_storeu_si128(dp + 0, v0);
+        _mm_storeu_si128(dp + 1, v1);
+        _mm_storeu_si128(dp + 2, v2);
+        _mm_storeu_si128(dp + 3, v3);
+        sp += 4;
+        dp += 4;
+    }
+}
+
+static bool streaming_reads_supported() {
+    static const bool supported = __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+#elif defined(__aarch64__)
+static void stream_chunks_from_device(void *dest, const void *src, std::size_t num_chunks) {
+    typedef std::uint64_t copy_t;
+    constexpr std::size_t words_per_chunk = STREAMING_READ_CHUNK_SIZE / sizeof(copy_t);
+
+    const volatile copy_t *sp = static_cast<const volatile copy_t *>(src);
+    char *dp = static_cast<char *>(dest);
+
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        copy_t chunk[words_per_chunk];
+        for (std::size_t w = 0; w < words_per_chunk; w++) {
+            chunk[w] = *sp++;
+        }
+        std::memcpy(dp, chunk, sizeof(chunk));
+        dp += sizeof(chunk);
+    }
+}
+
+static bool streaming_reads_supported() { return true; }
+#else
+static void stream_chunks_from_device(void *dest, const void *src, std::size_t num_chunks) {
+    memcpy_from_device(dest, src, num_chunks * STREAMING_READ_CHUNK_SIZE);
+}
+
+static bool streaming_reads_supported() { return false; }
+#endif
+
+// Copies from a write-combined device mapping in 64-byte chunks. The unaligned head and the sub-chunk tail go through
+// memcpy_from_device, so this has the same access restrictions as memcpy_from_device.
+inline void memcpy_from_device_streaming(void *dest, const void *src, std::size_t num_bytes) {
+    std::uintptr_t src_addr = reinterpret_cast<std::uintptr_t>(src);
+    std::size_t src_misalignment = src_addr % STREAMING_READ_ALIGNMENT;
+    std::size_t leading_len =
+        src_misalignment == 0 ? 0 : std::min(STREAMING_READ_ALIGNMENT - src_misalignment, num_bytes);
+
+    if (leading_len != 0) {
+        memcpy_from_device(dest, src, leading_len);
+        num_bytes -= leading_len;
+        src = static_cast<const char *>(src) + leading_len;
+        dest = static_cast<char *>(dest) + leading_len;
+    }
+
+    std::size_t num_chunks = num_bytes / STREAMING_READ_CHUNK_SIZE;
+    // Streaming loads are weakly ordered, make sure they don't pass earlier stores (e.g. TLB programming).
+    tt_driver_atomics::mfence();
+    stream_chunks_from_device(dest, src, num_chunks);
+    tt_driver_atomics::lfence();
+
+    std::size_t chunked_len = num_chunks * STREAMING_READ_CHUNK_SIZE;
+    if (num_bytes != chunked_len) {
+        memcpy_from_device(
+            static_cast<char *>(dest) + chunked_len,
+            static_cast<const char *>(src) + chunked_len,
+            num_bytes - chunked_len);
+    }
+}
+
 tt::ARCH PciDeviceInfo::get_arch() const {
     if (this->device_id == GS_PCIE_DEVICE_ID) {
         return tt::ARCH::GRAYSKULL;
@@ -511,15 +603,20 @@ void PCIDevice::write_block(uint64_t byte_addr, uint64_t num_bytes, const uint8_
 
 void PCIDevice::read_block(uint64_t byte_addr, uint64_t num_bytes, uint8_t *buffer_addr) {
     void *src = nullptr;
+    bool wc_mapped = false;
     if (bar4_wc != nullptr && byte_addr >= BAR0_BH_SIZE) {
         byte_addr -= BAR0_BH_SIZE;
         src = reinterpret_cast<uint8_t *>(bar4_wc) + byte_addr;
+        wc_mapped = true;
     } else {
         src = get_register_address<uint8_t>(byte_addr);
+        wc_mapped = bar0_wc != bar0_uc && byte_addr < bar0_wc_size;
     }
 
     void *dest = reinterpret_cast<void *>(buffer_addr);
-    if (arch == tt::ARCH::WORMHOLE_B0) {
+    if (wc_mapped && num_bytes >= streaming_read_min_size && streaming_reads_supported()) {
+        memcpy_from_device_streaming(dest, src, num_bytes);
+    } else if (arch == tt::ARCH::WORMHOLE_B0) {
         memcpy_from_device(dest, src, num_bytes);
     } else {
         memcpy(dest, src, num_bytes);
@@ -554,6 +651,55 @@ void PCIDevice::read_regs(uint32_t byte_addr, uint32_t word_len, void *data) {
     }
 }
 
+std::vector<uint32_t> PCIDevice::reg_batch(const std::vector<reg_batch_op> &ops) {
+    std::vector<uint32_t> read_values;
+    bool wc_writes_pending = false;
+
+    for (const reg_batch_op &op : ops) {
+        log_assert(op.byte_addr % sizeof(uint32_t) == 0, "Register address 0x{:x} is not 4-byte aligned", op.byte_addr);
+
+        volatile uint32_t *reg = nullptr;
+        bool wc_mapped = false;
+        if (bar4_wc != nullptr && op.byte_addr >= BAR0_BH_SIZE) {
+            reg = reinterpret_cast<uint32_t *>(static_cast<uint8_t *>(bar4_wc) + (op.byte_addr - BAR0_BH_SIZE));
+            wc_mapped = true;
+        } else {
+            reg = get_register_address<uint32_t>(op.byte_addr);
+            wc_mapped = bar0_wc != bar0_uc && op.byte_addr < bar0_wc_size;
+        }
+
+        if (op.type == reg_batch_op::Type::Write) {
+            *reg = op.value;
+            wc_writes_pending |= wc_mapped;
+            continue;
+        }
+
+        // Reads must observe all previous writes of the batch.
+        if (wc_writes_pending) {
+            tt_driver_atomics::mfence();
+            wc_writes_pending = false;
+        }
+
+        uint32_t value = *reg;
+        if (value == c_hang_read_value) {
+            detect_hang_read(value);
+        }
+
+        if (op.type == reg_batch_op::Type::Read) {
+            read_values.push_back(value);
+        } else {
+            *reg = (value & ~op.mask) | (op.value & op.mask);
+            wc_writes_pending |= wc_mapped;
+        }
+    }
+
+    if (wc_writes_pending) {
+        tt_driver_atomics::sfence();
+    }
+
+    return read_values;
+}
+
 void PCIDevice::write_tlb_reg(
     uint32_t byte_addr, uint64_t value_lower, uint64_t value_upper, uint32_t tlb_cfg_reg_size) {
     log_assert(
@@ -601,8 +747,9 @@ dynamic_tlb PCIDevice::set_dynamic_tlb(
     tt_xy_pair end,
     std::uint64_t address,
     bool multicast,
-    std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
-    std::uint64_t ordering) {
+    const tt::umd::CoordTranslationTable &harvested_coord_translation,
+    std::uint64_t ordering,
+    std::uint64_t noc_sel) {
     auto architecture_implementation = get_architecture_implementation();
     if (multicast) {
         std::tie(start, end) = architecture_implementation->multicast_workaround(start, end);
@@ -611,7 +758,7 @@ dynamic_tlb PCIDevice::set_dynamic_tlb(
     log_trace(
         LogSiliconDriver,
         "set_dynamic_tlb with arguments: tlb_index = {}, start = ({}, {}), end = ({}, {}), address = 0x{:x}, multicast "
-        "= {}, ordering = {}",
+        "= {}, ordering = {}, noc_sel = {}",
         tlb_index,
         start.x,
         start.y,
@@ -619,12 +766,36 @@ dynamic_tlb PCIDevice::set_dynamic_tlb(
         end.y,
         address,
         multicast,
-        (int)ordering);
+        (int)ordering,
+        noc_sel);
 
     tt::umd::tlb_configuration tlb_config = architecture_implementation->get_tlb_configuration(tlb_index);
     std::uint32_t TLB_CFG_REG_SIZE_BYTES = architecture_implementation->get_tlb_cfg_reg_size_bytes();
     auto translated_start_coords = harvested_coord_translation.at(start);
     auto translated_end_coords = harvested_coord_translation.at(end);
+    if (noc_sel == 1) {
+        // NOC1 runs in the opposite direction, so its physical coordinates are mirrored on both axes. NOC translated
+        // coordinates name the same core on both NOCs. Blackhole translates all coordinates, including the ones inside
+        // of the physical grid. Wormhole translates only coordinates outside of it, cores its translation tables don't
+        // cover keep their physical coordinates.
+        const bool noc_translation_enabled = harvested_coord_translation.is_noc_translation_enabled();
+        auto to_noc1 = [this, architecture_implementation, noc_translation_enabled](tt_xy_pair noc0) {
+            const std::size_t grid_size_x = architecture_implementation->get_grid_size_x();
+            const std::size_t grid_size_y = architecture_implementation->get_grid_size_y();
+            const bool translated =
+                noc_translation_enabled &&
+                (get_arch() == tt::ARCH::BLACKHOLE || noc0.x >= grid_size_x || noc0.y >= grid_size_y);
+            return translated ? noc0 : tt_xy_pair(grid_size_x - 1 - noc0.x, grid_size_y - 1 - noc0.y);
+        };
+        if (multicast) {
+            // Mirroring swaps the top left and bottom right corners of the multicast rectangle.
+            std::tie(translated_start_coords, translated_end_coords) =
+                std::make_pair(to_noc1(translated_end_coords), to_noc1(translated_start_coords));
+        } else {
+            translated_start_coords = to_noc1(translated_start_coords);
+            translated_end_coords = to_noc1(translated_end_coords);
+        }
+    }
     uint32_t tlb_address = address / tlb_config.size;
     uint32_t local_address = address % tlb_config.size;
     uint64_t tlb_base = tlb_config.base + (tlb_config.size * tlb_config.index_offset);
@@ -637,6 +808,7 @@ dynamic_tlb PCIDevice::set_dynamic_tlb(
             .y_end = static_cast<uint64_t>(translated_end_coords.y),
             .x_start = static_cast<uint64_t>(translated_start_coords.x),
             .y_start = static_cast<uint64_t>(translated_start_coords.y),
+            .noc_sel = noc_sel,
             .mcast = multicast,
             .ordering = ordering,
             // TODO #2715: hack for Blackhole A0, will potentially be fixed in B0.
@@ -664,15 +836,17 @@ dynamic_tlb PCIDevice::set_dynamic_tlb(
     unsigned int tlb_index,
     tt_xy_pair target,
     std::uint64_t address,
-    std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
-    std::uint64_t ordering) {
-    return set_dynamic_tlb(tlb_index, tt_xy_pair(0, 0), target, address, false, harvested_coord_translation, ordering);
+    const tt::umd::CoordTranslationTable &harvested_coord_translation,
+    std::uint64_t ordering,
+    std::uint64_t noc_sel) {
+    return set_dynamic_tlb(
+        tlb_index, tt_xy_pair(0, 0), target, address, false, harvested_coord_translation, ordering, noc_sel);
 }
 
 dynamic_tlb PCIDevice::set_dynamic_tlb_broadcast(
     unsigned int tlb_index,
     std::uint64_t address,
-    std::unordered_map<tt_xy_pair, tt_xy_pair> &harvested_coord_translation,
+    const tt::umd::CoordTranslationTable &harvested_coord_translation,
     tt_xy_pair start,
     tt_xy_pair end,
     std::uint64_t ordering) {
@@ -680,6 +854,11 @@ dynamic_tlb PCIDevice::set_dynamic_tlb_broadcast(
     return set_dynamic_tlb(tlb_index, start, end, address, true, harvested_coord_translation, ordering);
 }
 
+// Parses the number in front of the unit.
+double PCIDevice::get_link_speed() const { return read_sysfs<double>(info, "current_link_speed", 0.0); }
+
+int PCIDevice::get_link_width() const { return read_sysfs<int>(info, "current_link_width", 0); }
+
 tt::umd::architecture_implementation *PCIDevice::get_architecture_implementation() const {
     return architecture_implementation.get();
 }
@@ -687,8 +866,6 @@ tt::umd::architecture_implementation *PCIDevice::get_architecture_implementation
 bool PCIDevice::init_hugepage(uint32_t num_host_mem_channels) {
     const size_t hugepage_size = HUGEPAGE_REGION_SIZE;
 
-    auto physical_device_id = get_device_num();
-
     std::string hugepage_dir = find_hugepage_dir(hugepage_size);
     if (hugepage_dir.empty()) {
         log_warning(
@@ -698,110 +875,187 @@ bool PCIDevice::init_hugepage(uint32_t num_host_mem_channels) {
         return false;
     }
 
-    bool success = true;
-
     hugepage_mapping_per_channel.resize(num_host_mem_channels);
 
-    // Support for more than 1GB host memory accessible per device, via channels.
+    // Support for more than 1GB host memory accessible per device, via channels. Channels are independent, so they are
+    // populated and pinned in parallel.
+    std::vector<std::future<bool>> channels_initialized;
     for (int ch = 0; ch < num_host_mem_channels; ch++) {
-        int hugepage_fd = open_hugepage_file(hugepage_dir, physical_device_id, ch);
-        if (hugepage_fd == -1) {
-            // Probably a permissions problem.
-            log_warning(
-                LogSiliconDriver,
-                "ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} creating hugepage mapping file failed.",
-                physical_device_id,
-                ch);
-            success = false;
-            continue;
-        }
+        channels_initialized.push_back(std::async(
+            std::launch::async, [this, &hugepage_dir, ch] { return init_hugepage_channel(hugepage_dir, ch); }));
+    }
 
-        // Verify opened file size.
-        struct stat hugepage_st;
-        if (fstat(hugepage_fd, &hugepage_st) == -1) {
-            log_warning(LogSiliconDriver, "Error reading hugepage file size after opening.");
-        }
+    bool success = true;
+    for (auto &channel_initialized : channels_initialized) {
+        success &= channel_initialized.get();
+    }
+    return success;
+}
 
-        std::byte *mapping = static_cast<std::byte *>(
-            mmap(nullptr, hugepage_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, hugepage_fd, 0));
+bool PCIDevice::init_hugepage_channel(const std::string &hugepage_dir, uint16_t ch) {
+    const size_t hugepage_size = HUGEPAGE_REGION_SIZE;
+    const int num_host_mem_channels = hugepage_mapping_per_channel.size();
 
-        close(hugepage_fd);
+    auto physical_device_id = get_device_num();
 
-        if (mapping == MAP_FAILED) {
-            log_warning(
-                LogSiliconDriver,
-                "UMD: Mapping a hugepage failed. (device: {}, {}/{} errno: {}).",
-                physical_device_id,
-                ch,
-                num_host_mem_channels,
-                strerror(errno));
-            if (hugepage_st.st_size == 0) {
-                log_warning(
-                    LogSiliconDriver,
-                    "Opened hugepage file has zero size, mapping might've failed due to that. Verify that enough "
-                    "hugepages are provided.");
-            }
-            print_file_contents("/proc/cmdline");
-            print_file_contents(
-                "/sys/kernel/mm/hugepages/hugepages-1048576kB/nr_hugepages");  // Hardcoded for 1GB hugepage.
-            success = false;
-            continue;
-        }
+    int hugepage_fd = open_hugepage_file(hugepage_dir, physical_device_id, ch);
+    if (hugepage_fd == -1) {
+        // Probably a permissions problem.
+        log_warning(
+            LogSiliconDriver,
+            "ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} creating hugepage mapping file failed.",
+            physical_device_id,
+            ch);
+        return false;
+    }
 
-        // Beter performance if hugepage just allocated (populate flag to prevent lazy alloc) is migrated to same
-        // numanode as TT device.
-        if (!tt::cpuset::tt_cpuset_allocator::bind_area_to_memory_nodeset(physical_device_id, mapping, hugepage_size)) {
-            log_warning(
-                LogSiliconDriver,
-                "---- ttSiliconDevice::init_hugepage: bind_area_to_memory_nodeset() failed (physical_device_id: {} ch: "
-                "{}). "
-                "Hugepage allocation is not on NumaNode matching TT Device. Side-Effect is decreased Device->Host perf "
-                "(Issue #893).",
-                physical_device_id,
-                ch);
-        }
+    // Verify opened file size.
+    struct stat hugepage_st;
+    if (fstat(hugepage_fd, &hugepage_st) == -1) {
+        log_warning(LogSiliconDriver, "Error reading hugepage file size after opening.");
+    }
+
+    // hugetlbfs counts the hugepages backing a file in st_blocks. The hugepage of a file left behind by a previous
+    // process is already allocated, and most likely already on the right numa node. It still holds that process's
+    // data, the same as before hugepages were reused, since the file is never truncated.
+    const bool already_populated = static_cast<size_t>(hugepage_st.st_blocks) * 512 >= hugepage_size;
 
-        tenstorrent_pin_pages pin_pages;
-        memset(&pin_pages, 0, sizeof(pin_pages));
-        pin_pages.in.output_size_bytes = sizeof(pin_pages.out);
-        pin_pages.in.flags = TENSTORRENT_PIN_PAGES_CONTIGUOUS;
-        pin_pages.in.virtual_address = reinterpret_cast<std::uintptr_t>(mapping);
-        pin_pages.in.size = hugepage_size;
+    // A new hugepage is not populated until it is bound to the numa node of the device, so that it is allocated there
+    // rather than migrated there afterwards.
+    std::byte *mapping = static_cast<std::byte *>(mmap(
+        nullptr,
+        hugepage_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | (already_populated ? MAP_POPULATE : 0),
+        hugepage_fd,
+        0));
 
-        auto fd = get_fd();
+    close(hugepage_fd);
 
-        if (ioctl(fd, TENSTORRENT_IOCTL_PIN_PAGES, &pin_pages) == -1) {
+    if (mapping == MAP_FAILED) {
+        log_warning(
+            LogSiliconDriver,
+            "UMD: Mapping a hugepage failed. (device: {}, {}/{} errno: {}).",
+            physical_device_id,
+            ch,
+            num_host_mem_channels,
+            strerror(errno));
+        if (hugepage_st.st_size == 0) {
             log_warning(
                 LogSiliconDriver,
-                "---- ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} TENSTORRENT_IOCTL_PIN_PAGES failed "
-                "(errno: {}). Common Issue: Requires TTMKD >= 1.11, see following file contents...",
-                physical_device_id,
-                ch,
-                strerror(errno));
-            munmap(mapping, hugepage_size);
-            print_file_contents("/sys/module/tenstorrent/version", "(TTKMD version)");
-            print_file_contents("/proc/meminfo");
-            print_file_contents("/proc/buddyinfo");
-            success = false;
-            continue;
+                "Opened hugepage file has zero size, mapping might've failed due to that. Verify that enough "
+                "hugepages are provided.");
         }
+        print_file_contents("/proc/cmdline");
+        print_file_contents(
+            "/sys/kernel/mm/hugepages/hugepages-1048576kB/nr_hugepages");  // Hardcoded for 1GB hugepage.
+        return false;
+    }
 
-        hugepage_mapping_per_channel[ch] = {mapping, hugepage_size, pin_pages.out.physical_address};
-
+    if (already_populated &&
+        tt::cpuset::tt_cpuset_allocator::is_area_on_memory_nodeset(physical_device_id, mapping, hugepage_size)) {
         log_debug(
             LogSiliconDriver,
-            "ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} mapping_size: {} physical address 0x{:x}",
+            "ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} reusing hugepage on the device's NumaNode",
+            physical_device_id,
+            ch);
+    } else if (!tt::cpuset::tt_cpuset_allocator::bind_area_to_memory_nodeset(
+                   physical_device_id, mapping, hugepage_size)) {
+        // Beter performance if hugepage is on the same numanode as TT device.
+        log_warning(
+            LogSiliconDriver,
+            "---- ttSiliconDevice::init_hugepage: bind_area_to_memory_nodeset() failed (physical_device_id: {} ch: "
+            "{}). "
+            "Hugepage allocation is not on NumaNode matching TT Device. Side-Effect is decreased Device->Host perf "
+            "(Issue #893).",
+            physical_device_id,
+            ch);
+    }
+
+    if (!already_populated) {
+        // Fault the hugepage in, now that it is bound.
+        static_cast<void>(*reinterpret_cast<volatile std::uint8_t *>(mapping));
+    }
+
+    tenstorrent_pin_pages pin_pages;
+    memset(&pin_pages, 0, sizeof(pin_pages));
+    pin_pages.in.output_size_bytes = sizeof(pin_pages.out);
+    pin_pages.in.flags = TENSTORRENT_PIN_PAGES_CONTIGUOUS;
+    pin_pages.in.virtual_address = reinterpret_cast<std::uintptr_t>(mapping);
+    pin_pages.in.size = hugepage_size;
+
+    auto fd = get_fd();
+
+    if (ioctl(fd, TENSTORRENT_IOCTL_PIN_PAGES, &pin_pages) == -1) {
+        log_warning(
+            LogSiliconDriver,
+            "---- ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} TENSTORRENT_IOCTL_PIN_PAGES failed "
+            "(errno: {}). Common Issue: Requires TTMKD >= 1.11, see following file contents...",
             physical_device_id,
             ch,
-            hugepage_size,
-            (unsigned long long)hugepage_mappings.at(device_id).at(ch).physical_address);
+            strerror(errno));
+        munmap(mapping, hugepage_size);
+        print_file_contents("/sys/module/tenstorrent/version", "(TTKMD version)");
+        print_file_contents("/proc/meminfo");
+        print_file_contents("/proc/buddyinfo");
+        return false;
     }
 
-    return success;
+    hugepage_mapping_per_channel[ch] = {mapping, hugepage_size, pin_pages.out.physical_address};
+
+    log_debug(
+        LogSiliconDriver,
+        "ttSiliconDevice::init_hugepage: physical_device_id: {} ch: {} mapping_size: {} physical address 0x{:x} "
+        "already populated: {}",
+        physical_device_id,
+        ch,
+        hugepage_size,
+        (unsigned long long)pin_pages.out.physical_address,
+        already_populated);
+
+    return true;
 }
 
 int PCIDevice::get_num_host_mem_channels() const { return hugepage_mapping_per_channel.size(); }
 
+uint64_t PCIDevice::pin_host_memory(void *address, size_t size) {
+    tenstorrent_pin_pages pin_pages;
+    memset(&pin_pages, 0, sizeof(pin_pages));
+    pin_pages.in.output_size_bytes = sizeof(pin_pages.out);
+    pin_pages.in.virtual_address = reinterpret_cast<std::uintptr_t>(address);
+    pin_pages.in.size = size;
+
+    if (ioctl(get_fd(), TENSTORRENT_IOCTL_PIN_PAGES, &pin_pages) == -1) {
+        throw std::runtime_error(fmt::format(
+            "TENSTORRENT_IOCTL_PIN_PAGES failed for {} bytes at {} on device {} (errno: {}). Without an IOMMU the "
+            "memory has to be physically contiguous.",
+            size,
+            address,
+            pci_device_num,
+            strerror(errno)));
+    }
+    return pin_pages.out.physical_address;
+}
+
+void PCIDevice::unpin_host_memory(void *address, size_t size) {
+    tenstorrent_unpin_pages unpin_pages;
+    memset(&unpin_pages, 0, sizeof(unpin_pages));
+    unpin_pages.in.virtual_address = reinterpret_cast<std::uintptr_t>(address);
+    unpin_pages.in.size = size;
+
+    if (ioctl(get_fd(), TENSTORRENT_IOCTL_UNPIN_PAGES, &unpin_pages) == -1) {
+        // Older drivers can only unpin pages when the device is closed.
+        log_warning(
+            LogSiliconDriver,
+            "TENSTORRENT_IOCTL_UNPIN_PAGES failed for {} bytes at {} on device {} (errno: {}), the memory stays pinned "
+            "until the device is closed.",
+            size,
+            address,
+            pci_device_num,
+            strerror(errno));
+    }
+}
+
 hugepage_mapping PCIDevice::get_hugepage_mapping(int channel) const {
     if (channel < 0 || hugepage_mapping_per_channel.size() <= channel) {
         return {nullptr, 0, 0};
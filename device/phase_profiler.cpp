@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/phase_profiler.h"
+
+#include "fmt/core.h"
+
+namespace tt::umd {
+
+PhaseProfiler::ScopedPhase::~ScopedPhase() { profiler->end(phase); }
+
+std::size_t PhaseProfiler::begin(std::string name) {
+    phases.push_back({std::move(name), depth});
+    phase_starts.push_back(std::chrono::steady_clock::now());
+    depth++;
+    return phases.size() - 1;
+}
+
+void PhaseProfiler::end(std::size_t phase) {
+    phases.at(phase).duration = std::chrono::steady_clock::now() - phase_starts.at(phase);
+    depth--;
+}
+
+std::chrono::steady_clock::duration PhaseProfiler::get_total_duration() const {
+    std::chrono::steady_clock::duration total = {};
+    for (const auto& phase : phases) {
+        if (phase.depth == 0) {
+            total += phase.duration;
+        }
+    }
+    return total;
+}
+
+std::string PhaseProfiler::summary() const {
+    std::string summary = "";
+    for (const auto& phase : phases) {
+        summary += fmt::format(
+            "{:{}}{}: {:.3f} ms\n",
+            "",
+            2 * phase.depth,
+            phase.name,
+            std::chrono::duration<double, std::milli>(phase.duration).count());
+    }
+    return summary;
+}
+
+void PhaseProfiler::clear() {
+    phases.clear();
+    phase_starts.clear();
+    depth = 0;
+}
+
+}  // namespace tt::umd
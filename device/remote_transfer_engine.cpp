@@ -0,0 +1,513 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/remote_transfer_engine.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "logger.hpp"
+#include "umd/device/cluster.h"
+#include "umd/device/driver_atomics.h"
+#include "umd/device/driver_trace.h"
+
+namespace tt::umd {
+
+namespace {
+
+using data_word_t = uint32_t;
+constexpr int DATA_WORD_SIZE = sizeof(data_word_t);
+constexpr int BROADCAST_HEADER_SIZE = sizeof(data_word_t) * 8;  // Broadcast header is 8 words
+
+void resize_to_words(std::vector<data_word_t>& data_buf, std::uint32_t size_in_bytes) {
+    data_buf.resize((size_in_bytes + DATA_WORD_SIZE - 1) / DATA_WORD_SIZE);
+}
+
+// Copy size bytes at offset of the segments to dest.
+void copy_from_segments(SegmentList<const std::uint8_t>& source, std::uint64_t offset, void* dest, std::uint64_t size) {
+    source.for_each_piece(offset, size, [dest](Span<const std::uint8_t> piece, std::uint64_t piece_offset) {
+        std::memcpy(static_cast<std::uint8_t*>(dest) + piece_offset, piece.data(), piece.size());
+    });
+}
+
+// Copy size bytes from src to offset of the segments.
+void copy_to_segments(
+    SegmentList<std::uint8_t>& destination, std::uint64_t offset, const void* src, std::uint64_t size) {
+    destination.for_each_piece(offset, size, [src](Span<std::uint8_t> piece, std::uint64_t piece_offset) {
+        std::memcpy(piece.data(), static_cast<const std::uint8_t*>(src) + piece_offset, piece.size());
+    });
+}
+
+}  // namespace
+
+static_assert(sizeof(routing_cmd_t) == 32, "Ethernet firmware commands are 32 bytes");
+static_assert(sizeof(remote_update_ptr_t) == 16, "Ethernet firmware queue pointers are 16 bytes");
+
+RemoteTransferEngine::RemoteTransferEngine(
+    const tt_driver_eth_interface_params& eth_interface_params,
+    const tt_driver_host_address_params& host_address_params,
+    const tt_driver_noc_params& noc_params,
+    const TransferProfile& transfer_profile) :
+    eth_interface_params(eth_interface_params),
+    host_address_params(host_address_params),
+    noc_params(noc_params),
+    transfer_profile(transfer_profile) {}
+
+std::uint64_t RemoteTransferEngine::get_sys_addr(
+    std::uint32_t chip_x, std::uint32_t chip_y, std::uint32_t noc_x, std::uint32_t noc_y, std::uint64_t offset) const {
+    uint64_t result = chip_y;
+    uint64_t noc_addr_local_bits_mask = (1UL << noc_params.noc_addr_local_bits) - 1;
+    result <<= noc_params.noc_addr_node_id_bits;
+    result |= chip_x;
+    result <<= noc_params.noc_addr_node_id_bits;
+    result |= noc_y;
+    result <<= noc_params.noc_addr_node_id_bits;
+    result |= noc_x;
+    result <<= noc_params.noc_addr_local_bits;
+    result |= (noc_addr_local_bits_mask & offset);
+    return result;
+}
+
+std::uint16_t RemoteTransferEngine::get_sys_rack(std::uint32_t rack_x, std::uint32_t rack_y) const {
+    uint32_t result = rack_y;
+    result <<= eth_interface_params.eth_rack_coord_width;
+    result |= rack_x;
+
+    return result;
+}
+
+bool RemoteTransferEngine::is_cmd_q_full(std::uint32_t curr_wptr, std::uint32_t curr_rptr) const {
+    return (curr_wptr != curr_rptr) && ((curr_wptr & eth_interface_params.cmd_buf_size_mask) ==
+                                        (curr_rptr & eth_interface_params.cmd_buf_size_mask));
+}
+
+std::uint32_t RemoteTransferEngine::get_dram_block_size() const {
+    if (transfer_profile.remote_dram_block_size == 0) {
+        return host_address_params.eth_routing_block_size;
+    }
+    // The routing buffers could have been shrunk since the profile was set.
+    return std::min(transfer_profile.remote_dram_block_size, host_address_params.eth_routing_block_size);
+}
+
+void RemoteTransferEngine::read_request_q_ptrs(
+    RemoteTransferGateway& gateway, const tt_cxy_pair& eth_core, std::vector<std::uint32_t>& erisc_q_ptrs) {
+    erisc_q_ptrs.resize(eth_interface_params.remote_update_ptr_size_bytes * 2 / DATA_WORD_SIZE);
+    gateway.read_from_eth_core(
+        erisc_q_ptrs.data(),
+        eth_core,
+        eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
+        eth_interface_params.remote_update_ptr_size_bytes * 2);
+}
+
+void RemoteTransferEngine::push_command(
+    RemoteTransferGateway& gateway,
+    const tt_cxy_pair& eth_core,
+    const routing_cmd_t& command,
+    std::vector<std::uint32_t>& erisc_q_ptrs) {
+    const uint32_t req_wr_ptr = erisc_q_ptrs[0] & eth_interface_params.cmd_buf_size_mask;
+    gateway.write_to_eth_core(
+        &command,
+        sizeof(routing_cmd_t),
+        eth_core,
+        eth_interface_params.request_routing_cmd_queue_base + (sizeof(routing_cmd_t) * req_wr_ptr));
+    tt_driver_atomics::sfence();
+
+    // The firmware only picks the command up once the write pointer moves past it.
+    erisc_q_ptrs[0] = (erisc_q_ptrs[0] + 1) & eth_interface_params.cmd_buf_ptr_mask;
+    gateway.write_to_eth_core(
+        &erisc_q_ptrs[0],
+        DATA_WORD_SIZE,
+        eth_core,
+        eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes);
+    tt_driver_atomics::sfence();
+}
+
+std::uint32_t RemoteTransferEngine::write(
+    RemoteTransferGateway& gateway,
+    const RemoteTransferCores& cores,
+    const void* mem_ptr,
+    std::uint64_t size_in_bytes,
+    const eth_coord_t& target_chip,
+    const tt_xy_pair& core,
+    std::uint64_t address,
+    bool broadcast,
+    const std::vector<int>& broadcast_header) {
+    SegmentList<const std::uint8_t> source(
+        Span<const std::uint8_t>(static_cast<const std::uint8_t*>(mem_ptr), size_in_bytes));
+    return write(gateway, cores, source, target_chip, core, address, broadcast, broadcast_header);
+}
+
+std::uint32_t RemoteTransferEngine::write(
+    RemoteTransferGateway& gateway,
+    const RemoteTransferCores& cores,
+    SegmentList<const std::uint8_t>& source,
+    const eth_coord_t& target_chip,
+    const tt_xy_pair& core,
+    std::uint64_t address,
+    bool broadcast,
+    const std::vector<int>& broadcast_header) {
+    const std::uint64_t size_in_bytes = source.size_bytes();
+    std::vector<std::uint32_t> erisc_q_ptrs;
+    std::uint32_t erisc_q_rptr = 0;
+    std::vector<std::uint32_t> data_block;
+
+    uint32_t timestamp = 0;  // CMD_TIMESTAMP;
+
+    // Broadcast requires block writes to host dram
+    const bool use_dram = broadcast || (size_in_bytes > transfer_profile.remote_write_dram_threshold);
+    const uint32_t max_block_size = use_dram ? get_dram_block_size() : eth_interface_params.max_block_size;
+
+    int& active_core_for_txn = cores.active_core;
+    tt_cxy_pair remote_transfer_ethernet_core = cores.eth_cores.at(active_core_for_txn);
+    // Ethernet cores the write is queued on, which a flush of the target chip has to wait for.
+    std::uint32_t eth_core_mask = 1u << active_core_for_txn;
+
+    read_request_q_ptrs(gateway, remote_transfer_ethernet_core, erisc_q_ptrs);
+    uint64_t offset = 0;
+    uint32_t block_size;
+
+    bool full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
+    erisc_q_rptr = erisc_q_ptrs[4];
+    while (offset < size_in_bytes) {
+        if (full) {
+            TraceScope stall(
+                "Ethernet queue full", TraceCategory::EthernetQueueFull, remote_transfer_ethernet_core.chip);
+            while (full) {
+                gateway.read_from_eth_core(
+                    &erisc_q_rptr,
+                    remote_transfer_ethernet_core,
+                    eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
+                        eth_interface_params.remote_update_ptr_size_bytes,
+                    DATA_WORD_SIZE);
+                full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr);
+            }
+        }
+        //  full stays false after a command is queued unless it made the queue full, so that the read pointer is
+        //  not polled on every iteration.
+
+        uint32_t req_wr_ptr = erisc_q_ptrs[0] & eth_interface_params.cmd_buf_size_mask;
+        if ((address + offset) & 0x1F) {  // address not 32-byte aligned
+            block_size = DATA_WORD_SIZE;  // 4 byte aligned
+        } else {
+            // For broadcast we prepend a 32byte header. Decrease block size (size of payload) by this amount.
+            block_size = offset + max_block_size > size_in_bytes + 32 * broadcast
+                             ? static_cast<uint32_t>(size_in_bytes - offset)
+                             : max_block_size - 32 * broadcast;
+            // Explictly align block_size to 4 bytes, in case the input buffer is not uint32_t aligned
+            uint32_t alignment_mask = sizeof(uint32_t) - 1;
+            block_size = (block_size + alignment_mask) & ~alignment_mask;
+        }
+        // For 4 byte aligned data, transfer_size always == block_size. For unaligned data, transfer_size < block_size
+        // in the last block
+        uint64_t transfer_size =
+            std::min<uint64_t>(block_size, size_in_bytes - offset);  // Host side data size that needs to be copied
+        // Use block mode for broadcast
+        uint32_t req_flags = (broadcast || (block_size > DATA_WORD_SIZE))
+                                 ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_wr_req | timestamp)
+                                 : eth_interface_params.cmd_wr_req;
+        timestamp = 0;
+
+        if (broadcast) {
+            req_flags |= eth_interface_params.cmd_broadcast;
+        }
+
+        uint32_t host_dram_block_addr =
+            host_address_params.eth_routing_buffers_start +
+            (active_core_for_txn * eth_interface_params.cmd_buf_size + req_wr_ptr) * max_block_size;
+
+        if (req_flags & eth_interface_params.cmd_data_block) {
+            // Copy data to sysmem or device DRAM for Block mode
+            resize_to_words(data_block, block_size);
+            copy_from_segments(source, offset, data_block.data(), transfer_size);
+            if (use_dram) {
+                req_flags |= eth_interface_params.cmd_data_block_dram;
+                if (broadcast) {
+                    // Write broadcast header to sysmem
+                    gateway.write_to_sysmem(
+                        broadcast_header.data(), broadcast_header.size() * sizeof(uint32_t), host_dram_block_addr);
+                }
+                // Write payload to sysmem
+                gateway.write_to_sysmem(
+                    data_block.data(),
+                    data_block.size() * DATA_WORD_SIZE,
+                    host_dram_block_addr + BROADCAST_HEADER_SIZE * broadcast);
+            } else {
+                uint32_t buf_address = eth_interface_params.eth_routing_data_buffer_addr + req_wr_ptr * max_block_size;
+                gateway.write_to_eth_core(
+                    data_block.data(), data_block.size() * DATA_WORD_SIZE, remote_transfer_ethernet_core, buf_address);
+            }
+            tt_driver_atomics::sfence();
+        }
+
+        log_assert(
+            broadcast || (req_flags == eth_interface_params.cmd_wr_req) || (((address + offset) % 32) == 0),
+            "Block mode address must be 32-byte aligned.");
+
+        routing_cmd_t new_cmd = {};
+        if (broadcast) {
+            // Only specify endpoint local address for broadcast
+            new_cmd.sys_addr = address + offset;
+        } else {
+            new_cmd.sys_addr = get_sys_addr(target_chip.x, target_chip.y, core.x, core.y, address + offset);
+            new_cmd.rack = get_sys_rack(target_chip.rack, target_chip.shelf);
+        }
+
+        if (req_flags & eth_interface_params.cmd_data_block) {
+            // Block mode
+            new_cmd.data = block_size + BROADCAST_HEADER_SIZE * broadcast;
+        } else {
+            // Handle misalignment at the end of the buffer:
+            // Assemble a padded uint32_t from single bytes, in case we have less than 4 bytes remaining
+            copy_from_segments(
+                source, offset, &new_cmd.data, std::min<uint64_t>(DATA_WORD_SIZE, size_in_bytes - offset));
+        }
+
+        new_cmd.flags = req_flags;
+        if (use_dram) {
+            new_cmd.src_addr_tag = host_dram_block_addr;
+        }
+        push_command(gateway, remote_transfer_ethernet_core, new_cmd, erisc_q_ptrs);
+
+        offset += transfer_size;
+
+        // If there is more data to send and this command made the queue full, switch to the next core rather than
+        // wait for the firmware to catch up.
+        if (is_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr)) {
+            active_core_for_txn = ((active_core_for_txn + 1) & cores.core_mask) + cores.first_core;
+            remote_transfer_ethernet_core = cores.eth_cores.at(active_core_for_txn);
+            eth_core_mask |= 1u << active_core_for_txn;
+            read_request_q_ptrs(gateway, remote_transfer_ethernet_core, erisc_q_ptrs);
+            full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
+            erisc_q_rptr = erisc_q_ptrs[4];
+        }
+    }
+    return eth_core_mask;
+}
+
+void RemoteTransferEngine::read(
+    RemoteTransferGateway& gateway,
+    const tt_cxy_pair& eth_core,
+    void* mem_ptr,
+    const eth_coord_t& target_chip,
+    const tt_xy_pair& core,
+    std::uint64_t address,
+    std::uint64_t size_in_bytes,
+    std::optional<std::uint64_t> sysmem_offset) {
+    SegmentList<std::uint8_t> destination(Span<std::uint8_t>(static_cast<std::uint8_t*>(mem_ptr), size_in_bytes));
+    read(gateway, eth_core, destination, target_chip, core, address, sysmem_offset);
+}
+
+void RemoteTransferEngine::read(
+    RemoteTransferGateway& gateway,
+    const tt_cxy_pair& eth_core,
+    SegmentList<std::uint8_t>& destination,
+    const eth_coord_t& target_chip,
+    const tt_xy_pair& core,
+    std::uint64_t address,
+    std::optional<std::uint64_t> sysmem_offset) {
+    const std::uint64_t size_in_bytes = destination.size_bytes();
+    std::vector<std::uint32_t> erisc_q_ptrs;
+    std::uint32_t erisc_q_rptr = 0;
+    std::uint32_t erisc_resp_q_wptr = 0;
+    std::uint32_t erisc_resp_q_rptr = 0;
+    std::vector<std::uint32_t> data_block;
+
+    read_request_q_ptrs(gateway, eth_core, erisc_q_ptrs);
+    gateway.read_from_eth_core(
+        &erisc_resp_q_wptr,
+        eth_core,
+        eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
+        DATA_WORD_SIZE);
+    gateway.read_from_eth_core(
+        &erisc_resp_q_rptr,
+        eth_core,
+        eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
+            eth_interface_params.remote_update_ptr_size_bytes,
+        DATA_WORD_SIZE);
+
+    bool full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
+    erisc_q_rptr = erisc_q_ptrs[4];
+
+    const bool use_dram = sysmem_offset.has_value() || size_in_bytes > transfer_profile.remote_read_dram_threshold;
+    const uint32_t max_block_size = use_dram ? get_dram_block_size() : eth_interface_params.max_block_size;
+
+    uint64_t offset = 0;
+    uint32_t block_size;
+
+    while (offset < size_in_bytes) {
+        if (full) {
+            TraceScope stall("Ethernet queue full", TraceCategory::EthernetQueueFull, eth_core.chip);
+            while (full) {
+                gateway.read_from_eth_core(
+                    &erisc_q_rptr,
+                    eth_core,
+                    eth_interface_params.request_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes +
+                        eth_interface_params.remote_update_ptr_size_bytes,
+                    DATA_WORD_SIZE);
+                full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr);
+            }
+        }
+
+        if ((address + offset) & 0x1F) {  // address not 32-byte aligned
+            block_size = DATA_WORD_SIZE;  // 4 byte aligned block
+        } else {
+            block_size = offset + max_block_size > size_in_bytes ? static_cast<uint32_t>(size_in_bytes - offset)
+                                                                 : max_block_size;
+            // Align up to 4 bytes.
+            uint32_t alignment_mask = sizeof(uint32_t) - 1;
+            block_size = (block_size + alignment_mask) & ~alignment_mask;
+        }
+        uint32_t req_flags = block_size > DATA_WORD_SIZE
+                                 ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_rd_req)
+                                 : eth_interface_params.cmd_rd_req;
+        uint32_t resp_flags = block_size > DATA_WORD_SIZE
+                                  ? (eth_interface_params.cmd_data_block | eth_interface_params.cmd_rd_data)
+                                  : eth_interface_params.cmd_rd_data;
+        uint32_t resp_rd_ptr = erisc_resp_q_rptr & eth_interface_params.cmd_buf_size_mask;
+        uint32_t host_dram_block_addr = sysmem_offset ? *sysmem_offset + offset
+                                                      : host_address_params.eth_routing_buffers_start +
+                                                            resp_rd_ptr * max_block_size;
+
+        if (use_dram && block_size > DATA_WORD_SIZE) {
+            req_flags |= eth_interface_params.cmd_data_block_dram;
+            resp_flags |= eth_interface_params.cmd_data_block_dram;
+        }
+
+        // Send the read request
+        log_assert(
+            (req_flags == eth_interface_params.cmd_rd_req) || (((address + offset) & 0x1F) == 0),
+            "Block mode offset must be 32-byte aligned.");
+        routing_cmd_t new_cmd = {};
+        new_cmd.sys_addr = get_sys_addr(target_chip.x, target_chip.y, core.x, core.y, address + offset);
+        new_cmd.rack = get_sys_rack(target_chip.rack, target_chip.shelf);
+        new_cmd.data = block_size;
+        new_cmd.flags = req_flags;
+        if (use_dram) {
+            new_cmd.src_addr_tag = host_dram_block_addr;
+        }
+        push_command(gateway, eth_core, new_cmd, erisc_q_ptrs);
+
+        // If this command made the queue full, the read pointer has to be polled before the next one is queued.
+        if (is_cmd_q_full(erisc_q_ptrs[0], erisc_q_rptr)) {
+            read_request_q_ptrs(gateway, eth_core, erisc_q_ptrs);
+            full = is_cmd_q_full(erisc_q_ptrs[0], erisc_q_ptrs[4]);
+            erisc_q_rptr = erisc_q_ptrs[4];
+        }
+
+        // Wait for read request completion and extract the data into the destination
+
+        // erisc firmware will:
+        // 1. clear response flags
+        // 2. start operation
+        // 3. advance response wrptr
+        // 4. complete operation and write data into response or buffer
+        // 5. set response flags
+        // So we have to wait for wrptr to advance, then wait for flags to be nonzero, then read data.
+
+        do {
+            gateway.read_from_eth_core(
+                &erisc_resp_q_wptr,
+                eth_core,
+                eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes,
+                DATA_WORD_SIZE);
+        } while (erisc_resp_q_rptr == erisc_resp_q_wptr);
+        tt_driver_atomics::lfence();
+        uint32_t flags_offset = offsetof(routing_cmd_t, flags) + sizeof(routing_cmd_t) * resp_rd_ptr;
+        std::uint32_t erisc_resp_flags = 0;
+        do {
+            gateway.read_from_eth_core(
+                &erisc_resp_flags,
+                eth_core,
+                eth_interface_params.response_routing_cmd_queue_base + flags_offset,
+                DATA_WORD_SIZE);
+        } while (erisc_resp_flags == 0);
+
+        if (erisc_resp_flags == resp_flags) {
+            tt_driver_atomics::lfence();
+            uint32_t data_offset = offsetof(routing_cmd_t, data) + sizeof(routing_cmd_t) * resp_rd_ptr;
+            if (block_size == DATA_WORD_SIZE) {
+                std::uint32_t erisc_resp_data = 0;
+                gateway.read_from_eth_core(
+                    &erisc_resp_data,
+                    eth_core,
+                    eth_interface_params.response_routing_cmd_queue_base + data_offset,
+                    DATA_WORD_SIZE);
+                // Only the remaining bytes of a misaligned end of the buffer are copied.
+                copy_to_segments(
+                    destination,
+                    offset,
+                    &erisc_resp_data,
+                    std::min<std::uint64_t>(DATA_WORD_SIZE, size_in_bytes - offset));
+            } else if (!sysmem_offset) {
+                // Read 4 byte aligned block from device/sysmem. Zero copy reads have already landed in place.
+                resize_to_words(data_block, block_size);
+                if (use_dram) {
+                    gateway.read_from_sysmem(data_block.data(), host_dram_block_addr, block_size);
+                } else {
+                    uint32_t buf_address =
+                        eth_interface_params.eth_routing_data_buffer_addr + resp_rd_ptr * max_block_size;
+                    gateway.read_from_eth_core(data_block.data(), eth_core, buf_address, block_size);
+                }
+                // Account for misalignment by skipping any padding bytes in the copied data_block
+                copy_to_segments(
+                    destination,
+                    offset,
+                    data_block.data(),
+                    std::min<std::uint64_t>(block_size, size_in_bytes - offset));
+            }
+        }
+
+        // Finally increment the rdptr for the response command q
+        erisc_resp_q_rptr = (erisc_resp_q_rptr + 1) & eth_interface_params.cmd_buf_ptr_mask;
+        gateway.write_to_eth_core(
+            &erisc_resp_q_rptr,
+            DATA_WORD_SIZE,
+            eth_core,
+            eth_interface_params.response_cmd_queue_base + sizeof(remote_update_ptr_t) +
+                eth_interface_params.cmd_counters_size_bytes);
+        tt_driver_atomics::sfence();
+        log_assert(erisc_resp_flags == resp_flags, "Unexpected ERISC Response Flags.");
+
+        offset += block_size;
+    }
+}
+
+void RemoteTransferEngine::wait_for_cores(
+    RemoteTransferGateway& gateway, const std::vector<tt_cxy_pair>& eth_cores, std::uint32_t eth_core_mask) {
+    std::uint32_t erisc_txn_counters[2];
+    std::vector<std::uint32_t> erisc_q_ptrs;
+
+    // wait for all queues to be empty.
+    for (std::size_t i = 0; i < eth_cores.size(); i++) {
+        if (!(eth_core_mask & (1u << i))) {
+            continue;
+        }
+        do {
+            read_request_q_ptrs(gateway, eth_cores[i], erisc_q_ptrs);
+        } while (erisc_q_ptrs[0] != erisc_q_ptrs[4]);
+    }
+    // wait for all write responses to come back.
+    for (std::size_t i = 0; i < eth_cores.size(); i++) {
+        if (!(eth_core_mask & (1u << i))) {
+            continue;
+        }
+        do {
+            gateway.read_from_eth_core(
+                erisc_txn_counters,
+                eth_cores[i],
+                eth_interface_params.request_cmd_queue_base,
+                sizeof(erisc_txn_counters));
+        } while (erisc_txn_counters[0] != erisc_txn_counters[1]);
+    }
+}
+
+std::uint32_t RemoteTransferEngine::get_queue_occupancy(RemoteTransferGateway& gateway, const tt_cxy_pair& eth_core) {
+    std::vector<std::uint32_t> erisc_q_ptrs;
+    read_request_q_ptrs(gateway, eth_core, erisc_q_ptrs);
+    return (erisc_q_ptrs[0] - erisc_q_ptrs[4]) & eth_interface_params.cmd_buf_ptr_mask;
+}
+
+}  // namespace tt::umd
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/session_record.h"
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/permissions.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <cerrno>
+#include <stdexcept>
+
+#include "fmt/core.h"
+
+using namespace boost::interprocess;
+
+namespace tt::umd {
+
+// Layout of the record in shared memory. Zero filled memory is a valid record of an unconfigured device.
+struct SessionRecordData {
+    // Low bits hold the state, the rest is a counter bumped on every change, so that a process can tell whether
+    // another one changed the state since it last looked.
+    static constexpr std::uint64_t UNCONFIGURED = 0;
+    // Configured with fingerprint, and possibly in use.
+    static constexpr std::uint64_t CONFIGURED = 1;
+    // Configured with fingerprint, and closed cleanly by the last process using it.
+    static constexpr std::uint64_t IDLE = 2;
+    static constexpr std::uint64_t STATE_BITS = 2;
+    static constexpr std::uint64_t STATE_MASK = (1 << STATE_BITS) - 1;
+
+    std::atomic<std::uint64_t> state;
+    std::atomic<std::uint64_t> fingerprint;
+    std::atomic<std::uint32_t> eth_fw_version;
+    // Pids of the processes using the device, 0 for a free slot.
+    std::atomic<std::int32_t> pids[SessionRecord::MAX_PROCESSES];
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Session records are shared between processes");
+
+namespace {
+
+std::uint64_t next_state(std::uint64_t current, std::uint64_t state) {
+    return ((current >> SessionRecordData::STATE_BITS) + 1) << SessionRecordData::STATE_BITS | state;
+}
+
+bool is_process_alive(std::int32_t pid) { return kill(pid, 0) == 0 || errno == EPERM; }
+
+}  // namespace
+
+ConfigFingerprint& ConfigFingerprint::add(std::uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        hash ^= (value >> (8 * i)) & 0xff;
+        hash *= 1099511628211ULL;
+    }
+    return *this;
+}
+
+ConfigFingerprint& ConfigFingerprint::add(const std::string& value) {
+    add(value.size());
+    for (const char c : value) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return *this;
+}
+
+SessionRecord::SessionRecord(int pci_interface_id) {
+    permissions unrestricted_permissions;
+    unrestricted_permissions.set_unrestricted();
+    shared_memory_object shm(
+        open_or_create, get_shared_memory_name(pci_interface_id).c_str(), read_write, unrestricted_permissions);
+    offset_t size = 0;
+    if (!shm.get_size(size) || size < static_cast<offset_t>(sizeof(SessionRecordData))) {
+        shm.truncate(sizeof(SessionRecordData));
+    }
+    region = std::make_unique<mapped_region>(shm, read_write, 0, sizeof(SessionRecordData));
+    data = static_cast<SessionRecordData*>(region->get_address());
+}
+
+SessionRecord::~SessionRecord() { end_session(false); }
+
+std::string SessionRecord::get_shared_memory_name(int pci_interface_id) {
+    return fmt::format("TT_UMD_SESSION{}", pci_interface_id);
+}
+
+void SessionRecord::remove(int pci_interface_id) {
+    shared_memory_object::remove(get_shared_memory_name(pci_interface_id).c_str());
+}
+
+bool SessionRecord::other_processes_alive() {
+    bool alive = false;
+    for (std::size_t i = 0; i < MAX_PROCESSES; i++) {
+        std::int32_t pid = data->pids[i].load(std::memory_order_acquire);
+        if (pid == 0 || static_cast<int>(i) == process_slot) {
+            continue;
+        }
+        if (is_process_alive(pid)) {
+            alive = true;
+        } else {
+            // Left behind by a process which did not end its session.
+            data->pids[i].compare_exchange_strong(pid, 0, std::memory_order_acq_rel);
+        }
+    }
+    return alive;
+}
+
+bool SessionRecord::begin_session(std::uint64_t fingerprint) {
+    if (process_slot >= 0) {
+        throw std::runtime_error("A session on this device was already started by this process.");
+    }
+    const std::int32_t pid = getpid();
+    // The second attempt runs after the slots of dead processes were freed.
+    for (int attempt = 0; attempt < 2 && process_slot < 0; attempt++) {
+        if (attempt > 0) {
+            other_processes_alive();
+        }
+        for (std::size_t i = 0; i < MAX_PROCESSES && process_slot < 0; i++) {
+            std::int32_t free_slot = 0;
+            if (data->pids[i].compare_exchange_strong(free_slot, pid, std::memory_order_acq_rel)) {
+                process_slot = i;
+            }
+        }
+    }
+    if (process_slot < 0) {
+        throw std::runtime_error(fmt::format("More than {} processes are using the device.", MAX_PROCESSES));
+    }
+
+    // Registered before looking at the others, so of two processes starting together at least one sees the other.
+    const bool others_alive = other_processes_alive();
+    std::uint64_t current = data->state.load(std::memory_order_acquire);
+    const bool can_resume = !others_alive && (current & SessionRecordData::STATE_MASK) == SessionRecordData::IDLE &&
+                            data->fingerprint.load(std::memory_order_relaxed) == fingerprint;
+    // Unless it is resumed, the device is initialized again and its recorded configuration is not valid until
+    // record_configuration.
+    const std::uint64_t state = can_resume ? SessionRecordData::CONFIGURED : SessionRecordData::UNCONFIGURED;
+    while (!data->state.compare_exchange_weak(current, next_state(current, state), std::memory_order_acq_rel)) {
+    }
+    return can_resume;
+}
+
+void SessionRecord::record_configuration(std::uint64_t fingerprint, std::uint32_t eth_fw_version) {
+    data->fingerprint.store(fingerprint, std::memory_order_relaxed);
+    data->eth_fw_version.store(eth_fw_version, std::memory_order_relaxed);
+    std::uint64_t current = data->state.load(std::memory_order_acquire);
+    while (!data->state.compare_exchange_weak(
+        current, next_state(current, SessionRecordData::CONFIGURED), std::memory_order_acq_rel)) {
+    }
+}
+
+void SessionRecord::invalidate_configuration() {
+    std::uint64_t current = data->state.load(std::memory_order_acquire);
+    while (!data->state.compare_exchange_weak(
+        current, next_state(current, SessionRecordData::UNCONFIGURED), std::memory_order_acq_rel)) {
+    }
+}
+
+std::uint32_t SessionRecord::get_eth_fw_version() const {
+    return data->eth_fw_version.load(std::memory_order_relaxed);
+}
+
+void SessionRecord::end_session(bool clean_shutdown) {
+    if (process_slot < 0) {
+        return;
+    }
+    data->pids[process_slot].store(0, std::memory_order_release);
+    process_slot = -1;
+
+    std::uint64_t current = data->state.load(std::memory_order_acquire);
+    if (!clean_shutdown || (current & SessionRecordData::STATE_MASK) != SessionRecordData::CONFIGURED ||
+        other_processes_alive()) {
+        return;
+    }
+    // Fails if a process started a session since the state was read, that process decides what the state is.
+    data->state.compare_exchange_strong(
+        current, next_state(current, SessionRecordData::IDLE), std::memory_order_acq_rel);
+}
+
+}  // namespace tt::umd
@@ -191,13 +191,13 @@ void tt_SimulationDevice::wait_for_non_mmio_flush() {}
 void tt_SimulationDevice::wait_for_non_mmio_flush(const chip_id_t chip) {}
 
 void tt_SimulationDevice::l1_membar(
-    const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores) {}
+    const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores) {}
 
 void tt_SimulationDevice::dram_membar(
     const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<uint32_t>& channels) {}
 
 void tt_SimulationDevice::dram_membar(
-    const chip_id_t chip, const std::string& fallback_tlb, const std::unordered_set<tt_xy_pair>& cores) {}
+    const chip_id_t chip, const std::string& fallback_tlb, const tt::umd::CoreSet& cores) {}
 
 // Misc. Functions to Query/Set Device State
 std::unordered_map<chip_id_t, uint32_t> tt_SimulationDevice::get_harvesting_masks_for_soc_descriptors() {
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "umd/device/transfer_profile.h"
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "fmt/core.h"
+#include "umd/device/pci_device.hpp"
+#include "umd/device/tt_soc_descriptor.h"
+#include "yaml-cpp/yaml.h"
+
+namespace tt::umd {
+
+namespace {
+
+std::string get_cpu_model() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            const std::size_t separator = line.find(": ");
+            if (separator != std::string::npos) {
+                return line.substr(separator + 2);
+            }
+        }
+    }
+    return "unknown";
+}
+
+YAML::Node to_yaml(const TransferProfile& profile) {
+    YAML::Node node;
+    node["host"] = profile.host;
+    node["remote_write_dram_threshold"] = profile.remote_write_dram_threshold;
+    node["remote_read_dram_threshold"] = profile.remote_read_dram_threshold;
+    node["remote_dram_block_size"] = profile.remote_dram_block_size;
+    node["streaming_read_min_size"] = static_cast<std::uint64_t>(profile.streaming_read_min_size);
+    return node;
+}
+
+// Settings missing from the node keep their defaults, so that files written before a setting existed stay valid.
+TransferProfile from_yaml(const YAML::Node& node) {
+    TransferProfile profile;
+    profile.host = node["host"].as<std::string>();
+    if (node["remote_write_dram_threshold"]) {
+        profile.remote_write_dram_threshold = node["remote_write_dram_threshold"].as<std::uint32_t>();
+    }
+    if (node["remote_read_dram_threshold"]) {
+        profile.remote_read_dram_threshold = node["remote_read_dram_threshold"].as<std::uint32_t>();
+    }
+    if (node["remote_dram_block_size"]) {
+        profile.remote_dram_block_size = node["remote_dram_block_size"].as<std::uint32_t>();
+    }
+    if (node["streaming_read_min_size"]) {
+        profile.streaming_read_min_size = node["streaming_read_min_size"].as<std::uint64_t>();
+    }
+    return profile;
+}
+
+YAML::Node load_profiles(const std::string& path) {
+    try {
+        YAML::Node profiles = YAML::LoadFile(path)["profiles"];
+        if (!profiles) {
+            return YAML::Node(YAML::NodeType::Sequence);
+        }
+        if (!profiles.IsSequence()) {
+            throw std::runtime_error("profiles is not a list");
+        }
+        return profiles;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(fmt::format("Failed to parse transfer profile file {}: {}", path, e.what()));
+    }
+}
+
+}  // namespace
+
+bool TransferProfile::operator==(const TransferProfile& other) const {
+    return remote_write_dram_threshold == other.remote_write_dram_threshold &&
+           remote_read_dram_threshold == other.remote_read_dram_threshold &&
+           remote_dram_block_size == other.remote_dram_block_size &&
+           streaming_read_min_size == other.streaming_read_min_size && host == other.host;
+}
+
+std::string TransferProfile::get_host_description(const std::vector<const PCIDevice*>& devices) {
+    std::string description = fmt::format("CPU {}", get_cpu_model());
+    for (const PCIDevice* device : devices) {
+        description += fmt::format(
+            "; {} PCIe {:.1f} GT/s x{} NUMA {}",
+            get_arch_str(device->get_arch()),
+            device->get_link_speed(),
+            device->get_link_width(),
+            device->get_numa_node());
+    }
+    return description;
+}
+
+std::string TransferProfile::get_default_path() {
+    const char* path = std::getenv("TT_UMD_TRANSFER_PROFILE");
+    if (path != nullptr) {
+        return path;
+    }
+    const char* home = std::getenv("HOME");
+    if (home == nullptr) {
+        return "";
+    }
+    return (std::filesystem::path(home) / ".cache" / "tt-umd" / "transfer_profile.yaml").string();
+}
+
+std::optional<TransferProfile> TransferProfile::load(const std::string& path, const std::string& host) {
+    if (path.empty() || !std::filesystem::exists(path)) {
+        return std::nullopt;
+    }
+    const YAML::Node profiles = load_profiles(path);
+    try {
+        for (const YAML::Node& node : profiles) {
+            if (node["host"] && node["host"].as<std::string>() == host) {
+                return from_yaml(node);
+            }
+        }
+    } catch (const YAML::Exception& e) {
+        throw std::runtime_error(fmt::format("Failed to parse transfer profile file {}: {}", path, e.what()));
+    }
+    return std::nullopt;
+}
+
+void TransferProfile::save(const std::string& path) const {
+    if (path.empty()) {
+        throw std::runtime_error("No path to save the transfer profile to.");
+    }
+    YAML::Node profiles(YAML::NodeType::Sequence);
+    if (std::filesystem::exists(path)) {
+        for (const YAML::Node& node : load_profiles(path)) {
+            if (!node["host"] || node["host"].as<std::string>() != host) {
+                profiles.push_back(node);
+            }
+        }
+    }
+    profiles.push_back(to_yaml(*this));
+    YAML::Node root;
+    root["profiles"] = profiles;
+
+    const std::filesystem::path file_path(path);
+    if (file_path.has_parent_path()) {
+        std::filesystem::create_directories(file_path.parent_path());
+    }
+    // Written next to the file and renamed over it, so that a process loading the profile never sees half of it.
+    const std::string temporary_path = fmt::format("{}.{}", path, getpid());
+    {
+        std::ofstream file(temporary_path);
+        file << root << "\n";
+        if (!file) {
+            throw std::runtime_error(fmt::format("Failed to write transfer profile file {}", temporary_path));
+        }
+    }
+    std::filesystem::rename(temporary_path, path);
+}
+
+std::optional<std::size_t> TransferProfile::find_crossover(
+    const std::vector<double>& baseline_times, const std::vector<double>& alternative_times) {
+    if (baseline_times.size() != alternative_times.size()) {
+        throw std::runtime_error("Transfer times were not measured for the same sizes.");
+    }
+    std::size_t crossover = baseline_times.size();
+    while (crossover > 0 && alternative_times[crossover - 1] < baseline_times[crossover - 1]) {
+        crossover--;
+    }
+    if (crossover == baseline_times.size()) {
+        return std::nullopt;
+    }
+    return crossover;
+}
+
+}  // namespace tt::umd
@@ -4,8 +4,10 @@
 
 #include "umd/device/tt_cluster_descriptor.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
+#include <queue>
 #include <sstream>
 
 #include "disjoint_set.hpp"
@@ -347,8 +349,10 @@ chip_id_t tt_ClusterDescriptor::get_closest_mmio_capable_chip(const chip_id_t ch
         return chip;
     }
 
-    if (closest_mmio_chip_cache.find(chip) != closest_mmio_chip_cache.end()) {
-        return closest_mmio_chip_cache[chip];
+    // Filled for all chips when the descriptor is loaded, so concurrent callers only look it up.
+    auto cached_chip = closest_mmio_chip_cache.find(chip);
+    if (cached_chip != closest_mmio_chip_cache.end()) {
+        return cached_chip->second;
     }
 
     int min_distance = std::numeric_limits<int>::max();
@@ -387,6 +391,43 @@ chip_id_t tt_ClusterDescriptor::get_closest_mmio_capable_chip(const chip_id_t ch
     return closest_chip;
 }
 
+const std::vector<std::pair<chip_id_t, int>> &tt_ClusterDescriptor::get_mmio_capable_chips_by_distance(
+    const chip_id_t chip) {
+    auto cached = mmio_capable_chips_by_distance_cache.find(chip);
+    if (cached != mmio_capable_chips_by_distance_cache.end()) {
+        return cached->second;
+    }
+
+    // Walk the ethernet links, so that MMIO chips of unconnected boards are not reported.
+    std::vector<std::pair<chip_id_t, int>> mmio_chips = {};
+    std::unordered_set<chip_id_t> visited = {chip};
+    std::queue<chip_id_t> to_visit;
+    to_visit.push(chip);
+    while (!to_visit.empty()) {
+        const chip_id_t current = to_visit.front();
+        to_visit.pop();
+        if (is_chip_mmio_capable(current)) {
+            mmio_chips.push_back(
+                {current, get_ethernet_link_coord_distance(chip_locations.at(current), chip_locations.at(chip))});
+        }
+        auto connections = ethernet_connections.find(current);
+        if (connections == ethernet_connections.end()) {
+            continue;
+        }
+        for (const auto &[channel, remote_chip_and_channel] : connections->second) {
+            const chip_id_t remote_chip = std::get<0>(remote_chip_and_channel);
+            if (visited.insert(remote_chip).second) {
+                to_visit.push(remote_chip);
+            }
+        }
+    }
+    std::sort(mmio_chips.begin(), mmio_chips.end(), [](const auto &a, const auto &b) {
+        return std::tie(a.second, a.first) < std::tie(b.second, b.first);
+    });
+
+    return mmio_capable_chips_by_distance_cache[chip] = std::move(mmio_chips);
+}
+
 std::string tt_ClusterDescriptor::get_cluster_descriptor_file_path() {
     static std::string yaml_path;
     static bool is_initialized = false;
@@ -771,7 +812,15 @@ void tt_ClusterDescriptor::load_harvesting_information(YAML::Node &yaml, tt_Clus
     }
 }
 
-void tt_ClusterDescriptor::enable_all_devices() { this->enabled_active_chips = this->all_chips; }
+void tt_ClusterDescriptor::enable_all_devices() {
+    this->enabled_active_chips = this->all_chips;
+    this->enabled_chip_locations.clear();
+    for (auto chip_id : this->enabled_active_chips) {
+        if (this->chip_locations.find(chip_id) != this->chip_locations.end()) {
+            this->enabled_chip_locations[chip_id] = this->chip_locations.at(chip_id);
+        }
+    }
+}
 
 void tt_ClusterDescriptor::fill_chips_grouped_by_closest_mmio() {
     for (const auto &chip : this->all_chips) {
@@ -801,14 +850,7 @@ tt_ClusterDescriptor::get_ethernet_connections() const {
 }
 
 const std::unordered_map<chip_id_t, eth_coord_t> &tt_ClusterDescriptor::get_chip_locations() const {
-    static auto locations = std::unordered_map<chip_id_t, eth_coord_t>();
-    if (locations.empty() and !this->chip_locations.empty()) {
-        for (auto chip_id : this->enabled_active_chips) {
-            locations[chip_id] = chip_locations.at(chip_id);
-        }
-    }
-
-    return locations;
+    return enabled_chip_locations;
 }
 
 chip_id_t tt_ClusterDescriptor::get_shelf_local_physical_chip_coords(chip_id_t virtual_coord) {
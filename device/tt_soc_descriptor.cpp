@@ -6,6 +6,7 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <regex>
@@ -208,6 +209,63 @@ tt_SocDescriptor::tt_SocDescriptor(
     arch = get_arch_name(arch_name_value);
     load_soc_features_from_device_descriptor(device_descriptor_yaml);
     create_coordinate_manager(tensix_harvesting_mask, dram_harvesting_mask);
+    build_core_tables();
+}
+
+void tt_SocDescriptor::build_core_tables() const {
+    core_table_size = tt_xy_pair(0, 0);
+    for (const auto &[core, _] : cores) {
+        core_table_size.x = std::max(core_table_size.x, core.x + 1);
+        core_table_size.y = std::max(core_table_size.y, core.y + 1);
+    }
+
+    core_table.assign(core_table_size.x * core_table_size.y, 0);
+    for (const auto &[core, _] : cores) {
+        core_table[core_table_index(core)] |= IN_DESCRIPTOR;
+    }
+    for (const auto &[core, _] : ethernet_core_channel_map) {
+        const int index = core_table_index(core);
+        if (index >= 0) {
+            core_table[index] |= ETHERNET_CORE;
+        }
+    }
+
+    auto build_routing_table = [](const std::unordered_map<int, int> &routing_to_worker) {
+        int table_size = 0;
+        for (const auto &[routing_coord, _] : routing_to_worker) {
+            table_size = std::max(table_size, routing_coord + 1);
+        }
+        std::vector<bool> table(table_size, false);
+        for (const auto &[routing_coord, _] : routing_to_worker) {
+            table[routing_coord] = true;
+        }
+        return table;
+    };
+    routing_x_to_worker_x_table = build_routing_table(routing_x_to_worker_x);
+    routing_y_to_worker_y_table = build_routing_table(routing_y_to_worker_y);
+    core_table_sources = get_core_table_sources();
+}
+
+std::array<std::size_t, 5> tt_SocDescriptor::get_core_table_sources() const {
+    return {
+        cores.size(),
+        ethernet_core_channel_map.size(),
+        dram_core_channel_map.size(),
+        routing_x_to_worker_x.size(),
+        routing_y_to_worker_y.size()};
+}
+
+void tt_SocDescriptor::update_core_tables() const {
+    if (core_table_sources != get_core_table_sources()) {
+        build_core_tables();
+    }
+}
+
+int tt_SocDescriptor::core_table_index(const tt_xy_pair &core) const {
+    if (core.x >= core_table_size.x || core.y >= core_table_size.y) {
+        return -1;
+    }
+    return core.y * core_table_size.x + core.x;
 }
 
 int tt_SocDescriptor::get_num_dram_channels() const {
@@ -220,10 +278,16 @@ int tt_SocDescriptor::get_num_dram_channels() const {
     return num_channels;
 }
 
+bool tt_SocDescriptor::has(tt_xy_pair input) const {
+    update_core_tables();
+    const int index = core_table_index(input);
+    return index >= 0 && (core_table[index] & IN_DESCRIPTOR);
+}
+
 bool tt_SocDescriptor::is_worker_core(const tt_xy_pair &core) const {
-    return (
-        routing_x_to_worker_x.find(core.x) != routing_x_to_worker_x.end() &&
-        routing_y_to_worker_y.find(core.y) != routing_y_to_worker_y.end());
+    update_core_tables();
+    return core.x < routing_x_to_worker_x_table.size() && routing_x_to_worker_x_table[core.x] &&
+           core.y < routing_y_to_worker_y_table.size() && routing_y_to_worker_y_table[core.y];
 }
 
 tt_xy_pair tt_SocDescriptor::get_core_for_dram_channel(int dram_chan, int subchannel) const {
@@ -231,7 +295,33 @@ tt_xy_pair tt_SocDescriptor::get_core_for_dram_channel(int dram_chan, int subcha
 };
 
 bool tt_SocDescriptor::is_ethernet_core(const tt_xy_pair &core) const {
-    return this->ethernet_core_channel_map.find(core) != ethernet_core_channel_map.end();
+    update_core_tables();
+    const int index = core_table_index(core);
+    return index >= 0 && (core_table[index] & ETHERNET_CORE);
+}
+
+CoreType tt_SocDescriptor::get_core_type(const tt_xy_pair &core) const {
+    const auto core_descriptor = cores.find(core);
+    if (core_descriptor == cores.end()) {
+        throw std::out_of_range(fmt::format("Core {} is not part of the SOC descriptor.", core.str()));
+    }
+    return core_descriptor->second.type;
+}
+
+int tt_SocDescriptor::get_ethernet_channel(const tt_xy_pair &core) const {
+    const auto channel = ethernet_core_channel_map.find(core);
+    if (channel == ethernet_core_channel_map.end()) {
+        throw std::out_of_range(fmt::format("Core {} is not an ethernet core.", core.str()));
+    }
+    return channel->second;
+}
+
+int tt_SocDescriptor::get_dram_channel(const tt_xy_pair &core) const {
+    const auto channel = dram_core_channel_map.find(core);
+    if (channel == dram_core_channel_map.end()) {
+        throw std::out_of_range(fmt::format("Core {} is not a DRAM core.", core.str()));
+    }
+    return std::get<0>(channel->second);
 }
 
 std::string tt_SocDescriptor::get_soc_descriptor_path(tt::ARCH arch) {
@@ -233,3 +233,84 @@ TEST(ApiClusterTest, SimpleIOSpecificChips) {
         ASSERT_EQ(data, readback_data);
     }
 }
+
+TEST(ApiClusterTest, PostedWritesAllChips) {
+    std::unique_ptr<Cluster> umd_cluster = get_cluster();
+
+    if (umd_cluster == nullptr || umd_cluster->get_all_chips_in_cluster().empty()) {
+        GTEST_SKIP() << "No chips present on the system. Skipping test.";
+    }
+
+    const tt_ClusterDescriptor* cluster_desc = umd_cluster->get_cluster_description();
+
+    size_t data_size = 64 * 1024;
+    std::vector<uint8_t> data(data_size, 0);
+    for (int i = 0; i < data_size; i++) {
+        data[i] = (i * 7) % 256;
+    }
+
+    // TODO: this should be part of constructor if it is mandatory.
+    setup_wormhole_remote(umd_cluster.get());
+
+    for (auto chip_id : umd_cluster->get_all_chips_in_cluster()) {
+        const tt_SocDescriptor& soc_desc = umd_cluster->get_soc_descriptor(chip_id);
+
+        if (cluster_desc->is_chip_remote(chip_id) && soc_desc.arch != tt::ARCH::WORMHOLE_B0) {
+            std::cout << "Skipping remote chip " << chip_id << " because it is not a wormhole_b0 chip." << std::endl;
+            continue;
+        }
+
+        // Upload to all workers, then complete all of them with a single barrier.
+        for (const tt_xy_pair& core : soc_desc.workers) {
+            umd_cluster->write_to_device_posted(
+                data.data(), data_size, tt_cxy_pair(chip_id, core), 0, "LARGE_WRITE_TLB");
+        }
+        umd_cluster->posted_write_barrier(chip_id);
+
+        for (const tt_xy_pair& core : soc_desc.workers) {
+            std::vector<uint8_t> readback_data(data_size, 0);
+            umd_cluster->read_from_device(
+                readback_data.data(), tt_cxy_pair(chip_id, core), 0, data_size, "LARGE_READ_TLB");
+            ASSERT_EQ(data, readback_data);
+        }
+    }
+}
+
+TEST(ApiClusterTest, DualNocStripedIO) {
+    std::unique_ptr<Cluster> umd_cluster = get_cluster();
+
+    if (umd_cluster == nullptr || umd_cluster->get_all_chips_in_cluster().empty()) {
+        GTEST_SKIP() << "No chips present on the system. Skipping test.";
+    }
+
+    const tt_ClusterDescriptor* cluster_desc = umd_cluster->get_cluster_description();
+
+    // Large enough to be striped, with a chunk size that doesn't divide it evenly.
+    size_t data_size = 1024 * 1024 + 12;
+    std::vector<uint8_t> data(data_size, 0);
+    for (int i = 0; i < data_size; i++) {
+        data[i] = (i * 13) % 256;
+    }
+
+    umd_cluster->enable_dual_noc_striping("LARGE_READ_TLB", 48 * 1024, 1024 * 1024);
+
+    for (auto chip_id : umd_cluster->get_target_mmio_device_ids()) {
+        const tt_SocDescriptor& soc_desc = umd_cluster->get_soc_descriptor(chip_id);
+
+        // Striped write through LARGE_WRITE_TLB over NOC0 and LARGE_READ_TLB over NOC1.
+        tt_cxy_pair dram_core(chip_id, soc_desc.dram_cores.at(0).at(0));
+        umd_cluster->write_to_device(data.data(), data_size, dram_core, 0, "LARGE_WRITE_TLB");
+
+        // Reads through the NOC1 TLB itself are never striped.
+        std::vector<uint8_t> readback_data(data_size, 0);
+        umd_cluster->read_from_device(readback_data.data(), dram_core, 0, data_size, "LARGE_READ_TLB");
+        ASSERT_EQ(data, readback_data);
+
+        // Striped read.
+        std::fill(readback_data.begin(), readback_data.end(), 0);
+        umd_cluster->read_from_device(readback_data.data(), dram_core, 0, data_size, "LARGE_WRITE_TLB");
+        ASSERT_EQ(data, readback_data);
+    }
+
+    umd_cluster->disable_dual_noc_striping();
+}
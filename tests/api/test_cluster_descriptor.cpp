@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -133,3 +134,63 @@ TEST(ApiClusterDescriptorTest, SeparateClusters) {
         EXPECT_TRUE(chip_clusters.are_same_set(chip, closest_mmio_chip));
     }
 }
+
+// Tests that generated multi shelf and multi rack Galaxy topologies load, and that distances follow the mesh.
+TEST(ApiClusterDescriptorTest, GeneratedGalaxyTopologies) {
+    for (const auto& [num_racks, num_shelves] : std::vector<std::pair<int, int>>{{1, 1}, {1, 3}, {3, 1}}) {
+        test_utils::GalaxyTopology topology;
+        topology.num_racks = num_racks;
+        topology.num_shelves = num_shelves;
+        topology.mmio_chips_per_shelf = 2;
+        topology.harvesting_masks = {0, 1, 2};
+        const std::string cluster_desc_path = test_utils::generate_galaxy_cluster_desc(
+            topology,
+            (std::filesystem::temp_directory_path() /
+             fmt::format("umd_galaxy_{}_racks_{}_shelves.yaml", num_racks, num_shelves))
+                .string());
+        std::unique_ptr<tt_ClusterDescriptor> cluster_desc = tt_ClusterDescriptor::create_from_yaml(cluster_desc_path);
+        std::filesystem::remove(cluster_desc_path);
+
+        const int num_chips = num_racks * num_shelves * 32;
+        EXPECT_EQ(cluster_desc->get_number_of_chips(), num_chips);
+        EXPECT_EQ(cluster_desc->get_chips_with_mmio().size(), num_racks * num_shelves * 2);
+        EXPECT_EQ(cluster_desc->get_harvesting_info().at(4), 1);
+
+        for (chip_id_t chip = 0; chip < num_chips; chip++) {
+            EXPECT_TRUE(cluster_desc->is_chip_mmio_capable(cluster_desc->get_closest_mmio_capable_chip(chip)));
+        }
+
+        const chip_id_t first_chip = test_utils::get_galaxy_chip_id(topology, 0, 0, 0, 0);
+        const chip_id_t last_chip = test_utils::get_galaxy_chip_id(topology, 3, 7, num_racks - 1, num_shelves - 1);
+        // Each extra shelf adds a row crossing and the shelf link, each extra rack a column crossing and the rack link.
+        EXPECT_EQ(
+            cluster_desc->get_ethernet_link_distance(first_chip, last_chip),
+            3 + 7 + 4 * (num_shelves - 1) + 8 * (num_racks - 1));
+    }
+}
+
+TEST(ApiClusterDescriptorTest, MmioCapableChipsByDistance) {
+    // MMIO chips of other boards are not reachable, even though their coordinates are the same.
+    std::unique_ptr<tt_ClusterDescriptor> n300_cluster_desc = tt_ClusterDescriptor::create_from_yaml(
+        test_utils::GetAbsPath("tests/api/cluster_descriptor_examples/wormhole_2xN300_unconnected.yaml"));
+    EXPECT_EQ(
+        n300_cluster_desc->get_mmio_capable_chips_by_distance(2), (std::vector<std::pair<chip_id_t, int>>{{0, 1}}));
+    EXPECT_EQ(
+        n300_cluster_desc->get_mmio_capable_chips_by_distance(3), (std::vector<std::pair<chip_id_t, int>>{{1, 1}}));
+
+    test_utils::GalaxyTopology topology;
+    topology.mmio_chips_per_shelf = 2;
+    const std::string cluster_desc_path = test_utils::generate_galaxy_cluster_desc(
+        topology, (std::filesystem::temp_directory_path() / "umd_galaxy_mmio_chips_by_distance.yaml").string());
+    std::unique_ptr<tt_ClusterDescriptor> galaxy_cluster_desc =
+        tt_ClusterDescriptor::create_from_yaml(cluster_desc_path);
+    std::filesystem::remove(cluster_desc_path);
+
+    const chip_id_t chip = test_utils::get_galaxy_chip_id(topology, 3, 1, 0, 0);
+    const chip_id_t first_mmio_chip = test_utils::get_galaxy_chip_id(topology, 0, 0, 0, 0);
+    const chip_id_t second_mmio_chip = test_utils::get_galaxy_chip_id(topology, 0, 4, 0, 0);
+    EXPECT_EQ(
+        galaxy_cluster_desc->get_mmio_capable_chips_by_distance(chip),
+        (std::vector<std::pair<chip_id_t, int>>{{first_mmio_chip, 4}, {second_mmio_chip, 6}}));
+    EXPECT_EQ(galaxy_cluster_desc->get_closest_mmio_capable_chip(chip), first_mmio_chip);
+}
@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "gtest/gtest.h"
+#include "umd/device/cluster.h"
+#include "umd/device/coord_translation_table.h"
+
+using namespace tt::umd;
+
+// Tests that the dense table gives the same translation as the map it was built from, for all architectures and both
+// identity and NOC translated maps.
+TEST(CoordTranslationTable, MatchesTranslationMap) {
+    std::vector<std::pair<tt::ARCH, bool>> translations = {
+        {tt::ARCH::GRAYSKULL, true},
+        {tt::ARCH::WORMHOLE_B0, true},
+        {tt::ARCH::WORMHOLE_B0, false},
+        {tt::ARCH::BLACKHOLE, true},
+    };
+
+    for (const auto& [arch, identity_map] : translations) {
+        std::unordered_map<tt_xy_pair, tt_xy_pair> translation_map =
+            Cluster::create_harvested_coord_translation(arch, identity_map);
+        CoordTranslationTable translation_table(translation_map);
+
+        for (const auto& [core, translated_core] : translation_map) {
+            EXPECT_EQ(translation_table.at(core), translated_core);
+        }
+        EXPECT_EQ(translation_table.to_map(), translation_map);
+    }
+}
+
+// Tests that lookups outside of the grid throw, the same as lookups of missing keys in the map.
+TEST(CoordTranslationTable, OutOfGrid) {
+    CoordTranslationTable translation_table(Cluster::create_harvested_coord_translation(tt::ARCH::WORMHOLE_B0, true));
+
+    EXPECT_EQ(translation_table.get_grid_size(), tt_xy_pair(10, 12));
+    EXPECT_THROW(translation_table.at(tt_xy_pair(10, 0)), std::out_of_range);
+    EXPECT_THROW(translation_table.at(tt_xy_pair(0, 12)), std::out_of_range);
+    EXPECT_THROW(CoordTranslationTable().at(tt_xy_pair(0, 0)), std::out_of_range);
+}
+
+// Tests that the table keeps whether the chip has NOC translation enabled, which decides how TLBs address NOC1.
+TEST(CoordTranslationTable, NocTranslationEnabled) {
+    const auto translation_map = Cluster::create_harvested_coord_translation(tt::ARCH::WORMHOLE_B0, false);
+
+    EXPECT_FALSE(CoordTranslationTable().is_noc_translation_enabled());
+    EXPECT_FALSE(CoordTranslationTable(translation_map).is_noc_translation_enabled());
+    EXPECT_TRUE(CoordTranslationTable(translation_map, true).is_noc_translation_enabled());
+}
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "tests/test_utils/generate_cluster_desc.hpp"
+#include "umd/device/core_set.h"
+#include "umd/device/tt_soc_descriptor.h"
+
+using namespace tt::umd;
+
+// Tests that the set holds the same cores as the unordered_set it was built from and visits them in NOC order.
+TEST(CoreSet, MatchesUnorderedSet) {
+    tt_SocDescriptor soc_desc(test_utils::GetAbsPath("tests/soc_descs/wormhole_b0_8x10.yaml"));
+    std::unordered_set<tt_xy_pair> workers(soc_desc.workers.begin(), soc_desc.workers.end());
+    CoreSet core_set(workers);
+
+    EXPECT_EQ(core_set.size(), workers.size());
+    EXPECT_EQ(core_set.to_unordered_set(), workers);
+    for (const auto& core : soc_desc.ethernet_cores) {
+        EXPECT_FALSE(core_set.contains(core));
+    }
+
+    std::vector<tt_xy_pair> visited(core_set.begin(), core_set.end());
+    EXPECT_EQ(visited.size(), workers.size());
+    EXPECT_TRUE(std::is_sorted(visited.begin(), visited.end(), [](const tt_xy_pair& a, const tt_xy_pair& b) {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    }));
+}
+
+TEST(CoreSet, SetOperations) {
+    CoreSet a = {{1, 1}, {2, 1}, {63, 63}};
+    CoreSet b = {{2, 1}, {0, 5}};
+
+    EXPECT_EQ(a | b, CoreSet({{1, 1}, {2, 1}, {63, 63}, {0, 5}}));
+    EXPECT_EQ(a & b, CoreSet({{2, 1}}));
+    EXPECT_EQ(a - b, CoreSet({{1, 1}, {63, 63}}));
+    EXPECT_TRUE((a & b).is_subset_of(a));
+    EXPECT_FALSE(a.is_subset_of(b));
+
+    a.erase({63, 63});
+    EXPECT_EQ(a.size(), 2);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.begin(), a.end());
+
+    EXPECT_THROW(a.insert({64, 0}), std::out_of_range);
+    EXPECT_FALSE(a.contains({64, 0}));
+}
+
+// Tests that the rectangle decomposition covers exactly the cores of the set with disjoint rectangles.
+TEST(CoreSet, Rectangles) {
+    EXPECT_TRUE(CoreSet().to_rectangles().empty());
+
+    CoreSet grid = CoreSet::rectangle({1, 1}, {12, 10});
+    auto rectangles = grid.to_rectangles();
+    ASSERT_EQ(rectangles.size(), 1);
+    EXPECT_EQ(rectangles[0].first, tt_xy_pair(1, 1));
+    EXPECT_EQ(rectangles[0].second, tt_xy_pair(12, 10));
+
+    CoreSet full_width = CoreSet::rectangle({0, 2}, {63, 3});
+    EXPECT_EQ(full_width.size(), 128);
+    EXPECT_EQ(full_width.to_rectangles().size(), 1);
+
+    // Wormhole style worker grid, with column 5 and row 6 missing.
+    CoreSet workers = grid - CoreSet::rectangle({5, 0}, {5, 11}) - CoreSet::rectangle({0, 6}, {12, 6});
+    workers.insert({0, 0});
+    rectangles = workers.to_rectangles();
+    EXPECT_EQ(rectangles.size(), 5);
+
+    CoreSet covered;
+    std::size_t covered_size = 0;
+    for (const auto& [start, end] : rectangles) {
+        CoreSet rectangle = CoreSet::rectangle(start, end);
+        EXPECT_TRUE((covered & rectangle).empty());
+        covered |= rectangle;
+        covered_size += rectangle.size();
+    }
+    EXPECT_EQ(covered, workers);
+    EXPECT_EQ(covered_size, workers.size());
+}
+
+TEST(CoreSet, RowsAndColumns) {
+    EXPECT_FALSE(CoreSet().to_rows_and_columns().has_value());
+
+    // Wormhole style worker grid, with column 5 and row 6 missing.
+    CoreSet workers =
+        CoreSet::rectangle({1, 1}, {9, 11}) - CoreSet::rectangle({5, 0}, {5, 11}) - CoreSet::rectangle({0, 6}, {9, 6});
+    auto rows_and_columns = workers.to_rows_and_columns();
+    ASSERT_TRUE(rows_and_columns.has_value());
+    EXPECT_EQ(rows_and_columns->first, 0b111110111110);
+    EXPECT_EQ(rows_and_columns->second, 0b1111011110);
+
+    EXPECT_EQ(
+        CoreSet{tt_xy_pair(3, 63)}.to_rows_and_columns(), std::make_pair(std::uint64_t(1) << 63, std::uint64_t(1) << 3));
+
+    // A missing crossing can not be left out of a row/column broadcast.
+    workers.erase({2, 2});
+    EXPECT_FALSE(workers.to_rows_and_columns().has_value());
+}
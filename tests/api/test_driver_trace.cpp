@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "umd/device/driver_trace.h"
+
+using namespace tt::umd;
+
+namespace {
+
+std::size_t count_occurrences(const std::string& text, const std::string& pattern) {
+    std::size_t count = 0;
+    for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(DriverTrace, RingDropsEventsWhenFull) {
+    // Rounded up to 4 events.
+    TraceRing ring(3);
+    TraceEvent event;
+    event.name = "Event";
+    for (int i = 0; i < 4; i++) {
+        event.arg = i;
+        EXPECT_TRUE(ring.push(event));
+    }
+    EXPECT_FALSE(ring.push(event));
+    EXPECT_EQ(ring.get_dropped(), 1);
+
+    std::vector<TraceEvent> events = {};
+    EXPECT_EQ(ring.drain(events), 4);
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].arg, 0);
+    EXPECT_EQ(events[3].arg, 3);
+
+    EXPECT_TRUE(ring.push(event));
+    events.clear();
+    EXPECT_EQ(ring.drain(events), 1);
+}
+
+TEST(DriverTrace, ChromeTraceJson) {
+    const std::string trace_path = (std::filesystem::temp_directory_path() / "umd_driver_trace_test.json").string();
+
+    // Not recorded, tracing is off.
+    { TraceScope scope("Before start", TraceCategory::Transfer, 0, 4); }
+
+    DriverTrace::start(trace_path, 1024, std::chrono::milliseconds(1));
+    EXPECT_TRUE(DriverTrace::is_enabled());
+    EXPECT_THROW(DriverTrace::start(trace_path), std::runtime_error);
+
+    constexpr int num_events = 100;
+    std::thread chip_thread([] {
+        for (int i = 0; i < num_events; i++) {
+            TraceScope transfer("Write to device", TraceCategory::Transfer, 3, 64);
+            TraceScope mutex_wait("Wait for TLB mutex", TraceCategory::MutexWait, 3);
+        }
+    });
+    std::thread host_thread([] {
+        for (int i = 0; i < num_events; i++) {
+            TraceScope arc_message("ARC message", TraceCategory::ArcMessage, -1, 0xaa30);
+        }
+    });
+    chip_thread.join();
+    host_thread.join();
+    EXPECT_EQ(DriverTrace::get_dropped_events(), 0);
+    DriverTrace::stop();
+    EXPECT_FALSE(DriverTrace::is_enabled());
+
+    // Not recorded, tracing is off again.
+    { TraceScope scope("After stop", TraceCategory::Transfer, 0, 4); }
+
+    std::ifstream trace_file(trace_path);
+    std::stringstream trace_stream;
+    trace_stream << trace_file.rdbuf();
+    const std::string trace = trace_stream.str();
+    std::filesystem::remove(trace_path);
+
+    EXPECT_EQ(trace.rfind(R"({"displayTimeUnit":"ns","traceEvents":[)", 0), 0);
+    EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+    EXPECT_EQ(trace.find("Before start"), std::string::npos);
+    EXPECT_EQ(trace.find("After stop"), std::string::npos);
+
+    // Chip events are on both the thread and the chip track.
+    EXPECT_EQ(count_occurrences(trace, R"("ph":"X")"), 5 * num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("name":"Write to device","cat":"transfer")"), 2 * num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("name":"Wait for TLB mutex","cat":"mutex")"), 2 * num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("name":"ARC message","cat":"arc")"), num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("args":{"chip":3,"bytes":64})"), 2 * num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("args":{"msg_code":"0xaa30"})"), num_events);
+    EXPECT_EQ(count_occurrences(trace, R"("name":"thread_name")"), 3);
+    EXPECT_EQ(count_occurrences(trace, R"("args":{"name":"Chip 3"})"), 1);
+    EXPECT_EQ(count_occurrences(trace, R"("args":{"name":"Host"})"), 1);
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "umd/device/host_memory_registration_cache.h"
+
+using namespace tt::umd;
+
+namespace {
+
+HostMemoryRegistration make_registration(std::uintptr_t start, std::size_t size, std::uint32_t window) {
+    HostMemoryRegistration registration;
+    registration.start = start;
+    registration.size = size;
+    registration.iova = start + 0x100000000;
+    registration.window = window;
+    return registration;
+}
+
+}  // namespace
+
+TEST(HostMemoryRegistrationCache, ReuseCoveringRegistration) {
+    HostMemoryRegistrationCache cache({1, 2});
+    EXPECT_FALSE(cache.acquire(0x10000, 0x1000).has_value());
+
+    std::optional<HostMemoryRegistration> evicted;
+    const std::uint32_t window = cache.allocate_window(evicted);
+    EXPECT_FALSE(evicted.has_value());
+    cache.insert(make_registration(0x10000, 0x4000, window));
+
+    // Any range inside of the registration reuses it, ranges sticking out of it do not.
+    auto registration = cache.acquire(0x11000, 0x2000);
+    ASSERT_TRUE(registration.has_value());
+    EXPECT_EQ(registration->window, window);
+    EXPECT_EQ(registration->users, 2);
+    EXPECT_FALSE(cache.acquire(0x13000, 0x2000).has_value());
+    EXPECT_FALSE(cache.acquire(0xf000, 0x2000).has_value());
+}
+
+TEST(HostMemoryRegistrationCache, EvictLeastRecentlyUsed) {
+    HostMemoryRegistrationCache cache({1, 2});
+    std::optional<HostMemoryRegistration> evicted;
+    cache.insert(make_registration(0x10000, 0x1000, cache.allocate_window(evicted)));
+    cache.insert(make_registration(0x20000, 0x1000, cache.allocate_window(evicted)));
+
+    // Registrations with users are never evicted.
+    EXPECT_THROW(cache.allocate_window(evicted), std::runtime_error);
+
+    cache.release(0x10000);
+    cache.release(0x20000);
+    // Reusing the first registration makes the second one the least recently used.
+    cache.acquire(0x10000, 0x1000);
+    cache.release(0x10000);
+
+    const std::uint32_t window = cache.allocate_window(evicted);
+    ASSERT_TRUE(evicted.has_value());
+    EXPECT_EQ(evicted->start, 0x20000);
+    EXPECT_EQ(window, evicted->window);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(HostMemoryRegistrationCache, Invalidate) {
+    HostMemoryRegistrationCache cache({1, 2});
+    std::optional<HostMemoryRegistration> evicted;
+    cache.insert(make_registration(0x10000, 0x1000, cache.allocate_window(evicted)));
+    cache.insert(make_registration(0x20000, 0x1000, cache.allocate_window(evicted)));
+
+    // Memory still in use cannot be invalidated.
+    EXPECT_THROW(cache.invalidate(0x10000, 0x1000), std::runtime_error);
+    EXPECT_THROW(cache.release(0x30000), std::invalid_argument);
+
+    cache.release(0x10000);
+    const auto invalidated = cache.invalidate(0x10800, 0x100);
+    ASSERT_EQ(invalidated.size(), 1);
+    EXPECT_EQ(invalidated[0].start, 0x10000);
+    EXPECT_FALSE(cache.acquire(0x10000, 0x1000).has_value());
+
+    // The window of the invalidated registration is free again.
+    EXPECT_NO_THROW(cache.allocate_window(evicted));
+    EXPECT_FALSE(evicted.has_value());
+}
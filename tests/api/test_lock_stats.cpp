@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <boost/interprocess/sync/named_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <thread>
+
+#include "umd/device/lock_stats.h"
+
+using namespace boost::interprocess;
+using namespace tt::umd;
+
+TEST(LockStats, ContendedMutex) {
+    // Far above the id of any real device.
+    constexpr int pci_interface_id = 4242;
+    const std::string mutex_name = "UMD_TEST_LOCK_STATS";
+    LockStatsTable::remove(pci_interface_id);
+    named_mutex::remove(mutex_name.c_str());
+    EXPECT_TRUE(read_lock_stats(pci_interface_id).empty());
+
+    LockStatsTable table(pci_interface_id);
+    // Both threads use their own handle of the named mutex, like two processes would.
+    ProfiledNamedMutex first_mutex(
+        std::make_unique<named_mutex>(open_or_create, mutex_name.c_str()), table.get_slot(mutex_name));
+    ProfiledNamedMutex second_mutex(
+        std::make_unique<named_mutex>(open_or_create, mutex_name.c_str()), table.get_slot(mutex_name));
+
+    {
+        scoped_lock<ProfiledNamedMutex> lock(first_mutex);
+        std::thread waiter([&] { scoped_lock<ProfiledNamedMutex> waiter_lock(second_mutex); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        const std::vector<LockStats> held_stats = read_lock_stats(pci_interface_id);
+        ASSERT_EQ(held_stats.size(), 1);
+        EXPECT_EQ(held_stats[0].name, mutex_name);
+        EXPECT_EQ(held_stats[0].holder_pid, getpid());
+        EXPECT_NE(held_stats[0].holder_tid, 0);
+        EXPECT_GE(held_stats[0].current_hold, std::chrono::milliseconds(20));
+
+        lock.unlock();
+        waiter.join();
+    }
+
+    const std::vector<LockStats> stats = table.read();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].acquisitions, 2);
+    EXPECT_EQ(stats[0].contended_acquisitions, 1);
+    EXPECT_GE(stats[0].max_wait, std::chrono::milliseconds(20));
+    EXPECT_GE(stats[0].max_hold, std::chrono::milliseconds(20));
+    EXPECT_GE(stats[0].total_hold, stats[0].max_hold);
+    EXPECT_EQ(stats[0].holder_pid, 0);
+
+    table.reset();
+    EXPECT_EQ(table.read()[0].acquisitions, 0);
+
+    LockStatsTable::remove(pci_interface_id);
+    named_mutex::remove(mutex_name.c_str());
+}
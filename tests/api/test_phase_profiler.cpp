@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "umd/device/phase_profiler.h"
+
+using namespace tt::umd;
+
+TEST(PhaseProfiler, NestedPhases) {
+    PhaseProfiler profiler;
+    {
+        auto outer = profiler.measure("Outer");
+        {
+            auto inner = profiler.measure("Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        const std::size_t unscoped = profiler.begin("Unscoped");
+        profiler.end(unscoped);
+    }
+    {
+        auto last = profiler.measure("Last");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto& phases = profiler.get_phases();
+    ASSERT_EQ(phases.size(), 4);
+    EXPECT_EQ(phases[0].name, "Outer");
+    EXPECT_EQ(phases[0].depth, 0);
+    EXPECT_EQ(phases[1].name, "Inner");
+    EXPECT_EQ(phases[1].depth, 1);
+    EXPECT_EQ(phases[2].depth, 1);
+    EXPECT_EQ(phases[3].depth, 0);
+
+    EXPECT_GE(phases[1].duration, std::chrono::milliseconds(2));
+    EXPECT_GE(phases[0].duration, phases[1].duration + phases[2].duration);
+    EXPECT_EQ(profiler.get_total_duration(), phases[0].duration + phases[3].duration);
+
+    const std::string summary = profiler.summary();
+    EXPECT_NE(summary.find("Outer: "), std::string::npos);
+    EXPECT_NE(summary.find("\n  Inner: "), std::string::npos);
+}
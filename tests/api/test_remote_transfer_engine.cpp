@@ -0,0 +1,397 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+
+#include "umd/device/blackhole_implementation.h"
+#include "umd/device/cluster.h"
+#include "umd/device/remote_transfer_engine.h"
+#include "umd/device/wormhole_implementation.h"
+
+using namespace tt::umd;
+
+namespace {
+
+// Emulated host memory past the routing buffers of 16 ethernet cores, for zero copy reads.
+constexpr std::uint64_t ZERO_COPY_SYSMEM_SIZE = 1 << 20;
+
+/**
+ * Software model of the ethernet firmware of an MMIO chip, following the host side of the protocol in
+ * RemoteTransferEngine. It keeps the L1 of the ethernet cores, channel 0 of host memory, and the memory of the remote
+ * chips. Firmware makes progress only when the host polls the L1 of a core: each poll services at most one command of
+ * the core, and acks at most one write serviced before, so that the host sees queues fill up and write acks lag.
+ */
+class EriscQueueEmulator : public RemoteTransferGateway {
+public:
+    EriscQueueEmulator(
+        const tt_driver_eth_interface_params& eth_interface_params,
+        const tt_driver_host_address_params& host_address_params,
+        const tt_driver_noc_params& noc_params,
+        const std::vector<tt_cxy_pair>& eth_cores) :
+        eth_interface_params(eth_interface_params),
+        host_address_params(host_address_params),
+        noc_params(noc_params),
+        eth_cores(eth_cores),
+        l1(eth_cores.size(), std::vector<std::uint8_t>(L1_SIZE)),
+        pending_acks(eth_cores.size()),
+        sysmem(routing_buffers_size() + ZERO_COPY_SYSMEM_SIZE) {}
+
+    void write_to_eth_core(
+        const void* mem_ptr, std::uint32_t size_in_bytes, const tt_cxy_pair& eth_core, std::uint64_t address) override {
+        std::memcpy(l1_ptr(get_core_index(eth_core), address, size_in_bytes), mem_ptr, size_in_bytes);
+    }
+
+    void read_from_eth_core(
+        void* mem_ptr, const tt_cxy_pair& eth_core, std::uint64_t address, std::uint32_t size_in_bytes) override {
+        const std::size_t core_index = get_core_index(eth_core);
+        step(core_index);
+        std::memcpy(mem_ptr, l1_ptr(core_index, address, size_in_bytes), size_in_bytes);
+    }
+
+    void write_to_sysmem(const void* mem_ptr, std::uint32_t size_in_bytes, std::uint64_t address) override {
+        std::memcpy(sysmem_ptr(address, size_in_bytes), mem_ptr, size_in_bytes);
+    }
+
+    void read_from_sysmem(void* mem_ptr, std::uint64_t address, std::uint32_t size_in_bytes) override {
+        std::memcpy(mem_ptr, sysmem_ptr(address, size_in_bytes), size_in_bytes);
+    }
+
+    std::uint8_t* sysmem_ptr(std::uint64_t address, std::uint64_t size) {
+        if (address < host_address_params.eth_routing_buffers_start ||
+            address + size > host_address_params.eth_routing_buffers_start + sysmem.size()) {
+            throw std::out_of_range("Access outside of the emulated host memory");
+        }
+        return sysmem.data() + (address - host_address_params.eth_routing_buffers_start);
+    }
+
+    // Offset of host memory past the routing buffers, for zero copy reads.
+    std::uint64_t get_zero_copy_offset() const {
+        return host_address_params.eth_routing_buffers_start + routing_buffers_size();
+    }
+
+    std::vector<std::uint8_t> read_remote(
+        const eth_coord_t& chip, const tt_xy_pair& core, std::uint64_t address, std::uint32_t size) {
+        std::vector<std::uint8_t>& memory = remote_memory[{chip.rack, chip.shelf, chip.x, chip.y, core.x, core.y}];
+        if (memory.size() < address + size) {
+            memory.resize(address + size);
+        }
+        return std::vector<std::uint8_t>(memory.begin() + address, memory.begin() + address + size);
+    }
+
+    // Writes serviced by the firmware whose ack did not come back yet.
+    std::uint32_t get_unacknowledged_writes() const {
+        return std::accumulate(pending_acks.begin(), pending_acks.end(), 0u);
+    }
+
+private:
+    static constexpr std::uint64_t L1_SIZE = 256 * 1024;
+
+    std::uint64_t routing_buffers_size() const {
+        return std::uint64_t(16) * eth_interface_params.cmd_buf_size * host_address_params.eth_routing_block_size;
+    }
+
+    std::size_t get_core_index(const tt_cxy_pair& eth_core) const {
+        for (std::size_t i = 0; i < eth_cores.size(); i++) {
+            if (eth_cores[i] == eth_core) {
+                return i;
+            }
+        }
+        throw std::runtime_error("Access to an ethernet core which does not carry remote transfers");
+    }
+
+    std::uint8_t* l1_ptr(std::size_t core_index, std::uint64_t address, std::uint64_t size) {
+        if (address + size > L1_SIZE) {
+            throw std::out_of_range("Access outside of the emulated ethernet core L1");
+        }
+        return l1[core_index].data() + address;
+    }
+
+    std::uint32_t& l1_word(std::size_t core_index, std::uint64_t address) {
+        return *reinterpret_cast<std::uint32_t*>(l1_ptr(core_index, address, sizeof(std::uint32_t)));
+    }
+
+    std::vector<std::uint8_t>& remote_memory_at(std::uint16_t rack, std::uint64_t sys_addr, std::uint64_t size) {
+        const std::uint64_t node_id_mask = (1ULL << noc_params.noc_addr_node_id_bits) - 1;
+        const std::uint64_t local_address = sys_addr & ((1ULL << noc_params.noc_addr_local_bits) - 1);
+        std::uint64_t node_ids = sys_addr >> noc_params.noc_addr_local_bits;
+        const int noc_x = node_ids & node_id_mask;
+        node_ids >>= noc_params.noc_addr_node_id_bits;
+        const int noc_y = node_ids & node_id_mask;
+        node_ids >>= noc_params.noc_addr_node_id_bits;
+        const int chip_x = node_ids & node_id_mask;
+        node_ids >>= noc_params.noc_addr_node_id_bits;
+        const int chip_y = node_ids & node_id_mask;
+        const int rack_x = rack & ((1 << eth_interface_params.eth_rack_coord_width) - 1);
+        const int rack_y = rack >> eth_interface_params.eth_rack_coord_width;
+        std::vector<std::uint8_t>& memory = remote_memory[{rack_x, rack_y, chip_x, chip_y, noc_x, noc_y}];
+        if (memory.size() < local_address + size) {
+            memory.resize(local_address + size);
+        }
+        return memory;
+    }
+
+    void step(std::size_t core_index) {
+        const std::uint64_t counters = eth_interface_params.request_cmd_queue_base;
+        const std::uint64_t request_wptr = counters + eth_interface_params.cmd_counters_size_bytes;
+        const std::uint64_t request_rptr = request_wptr + eth_interface_params.remote_update_ptr_size_bytes;
+        if (pending_acks[core_index] > 0) {
+            pending_acks[core_index]--;
+            l1_word(core_index, counters + sizeof(std::uint32_t))++;
+        }
+        std::uint32_t& rptr = l1_word(core_index, request_rptr);
+        if (l1_word(core_index, request_wptr) == rptr) {
+            return;
+        }
+        const std::uint32_t slot = rptr & eth_interface_params.cmd_buf_size_mask;
+        routing_cmd_t command;
+        std::memcpy(
+            &command,
+            l1_ptr(core_index, eth_interface_params.request_routing_cmd_queue_base + slot * sizeof(routing_cmd_t), 32),
+            sizeof(routing_cmd_t));
+        if (command.flags & eth_interface_params.cmd_broadcast) {
+            throw std::runtime_error("The emulator does not model broadcasts");
+        }
+        if (command.flags & eth_interface_params.cmd_wr_req) {
+            service_write(core_index, slot, command);
+        } else if (command.flags & eth_interface_params.cmd_rd_req) {
+            service_read(core_index, command);
+        } else {
+            throw std::runtime_error("Unknown command");
+        }
+        rptr = (rptr + 1) & eth_interface_params.cmd_buf_ptr_mask;
+    }
+
+    void service_write(std::size_t core_index, std::uint32_t slot, const routing_cmd_t& command) {
+        const std::uint64_t local_address = command.sys_addr & ((1ULL << noc_params.noc_addr_local_bits) - 1);
+        const bool block = command.flags & eth_interface_params.cmd_data_block;
+        const std::uint32_t size = block ? command.data : sizeof(std::uint32_t);
+        std::vector<std::uint8_t>& memory = remote_memory_at(command.rack, command.sys_addr, size);
+        if (!block) {
+            std::memcpy(memory.data() + local_address, &command.data, size);
+        } else if (command.flags & eth_interface_params.cmd_data_block_dram) {
+            std::memcpy(memory.data() + local_address, sysmem_ptr(command.src_addr_tag, size), size);
+        } else {
+            const std::uint64_t buffer =
+                eth_interface_params.eth_routing_data_buffer_addr + slot * eth_interface_params.max_block_size;
+            std::memcpy(memory.data() + local_address, l1_ptr(core_index, buffer, size), size);
+        }
+        l1_word(core_index, eth_interface_params.request_cmd_queue_base)++;
+        pending_acks[core_index]++;
+    }
+
+    void service_read(std::size_t core_index, const routing_cmd_t& command) {
+        const std::uint64_t response_wptr =
+            eth_interface_params.response_cmd_queue_base + eth_interface_params.cmd_counters_size_bytes;
+        const std::uint64_t response_rptr = response_wptr + eth_interface_params.remote_update_ptr_size_bytes;
+        std::uint32_t& wptr = l1_word(core_index, response_wptr);
+        if (((wptr - l1_word(core_index, response_rptr)) & eth_interface_params.cmd_buf_ptr_mask) ==
+            eth_interface_params.cmd_buf_size) {
+            throw std::runtime_error("Response queue overflow");
+        }
+        const std::uint32_t slot = wptr & eth_interface_params.cmd_buf_size_mask;
+        const std::uint64_t local_address = command.sys_addr & ((1ULL << noc_params.noc_addr_local_bits) - 1);
+        const bool block = command.flags & eth_interface_params.cmd_data_block;
+        const std::uint32_t size = block ? command.data : sizeof(std::uint32_t);
+        const std::vector<std::uint8_t>& memory = remote_memory_at(command.rack, command.sys_addr, size);
+
+        routing_cmd_t response = {};
+        const std::uint32_t block_flags =
+            eth_interface_params.cmd_data_block | eth_interface_params.cmd_data_block_dram;
+        response.flags = eth_interface_params.cmd_rd_data | (command.flags & block_flags);
+        if (!block) {
+            std::memcpy(&response.data, memory.data() + local_address, size);
+        } else if (command.flags & eth_interface_params.cmd_data_block_dram) {
+            std::memcpy(sysmem_ptr(command.src_addr_tag, size), memory.data() + local_address, size);
+        } else {
+            const std::uint64_t buffer =
+                eth_interface_params.eth_routing_data_buffer_addr + slot * eth_interface_params.max_block_size;
+            std::memcpy(l1_ptr(core_index, buffer, size), memory.data() + local_address, size);
+        }
+        std::memcpy(
+            l1_ptr(core_index, eth_interface_params.response_routing_cmd_queue_base + slot * sizeof(routing_cmd_t), 32),
+            &response,
+            sizeof(routing_cmd_t));
+        wptr = (wptr + 1) & eth_interface_params.cmd_buf_ptr_mask;
+    }
+
+    const tt_driver_eth_interface_params& eth_interface_params;
+    const tt_driver_host_address_params& host_address_params;
+    const tt_driver_noc_params& noc_params;
+    const std::vector<tt_cxy_pair>& eth_cores;
+    std::vector<std::vector<std::uint8_t>> l1;
+    std::vector<std::uint32_t> pending_acks;
+    std::vector<std::uint8_t> sysmem;
+    // By rack, shelf, chip and NOC coordinates.
+    std::map<std::tuple<int, int, int, int, int, int>, std::vector<std::uint8_t>> remote_memory;
+};
+
+// The parameters of an architecture, and an engine and emulator using them.
+struct RemoteTransferSetup {
+    explicit RemoteTransferSetup(const architecture_implementation& architecture) :
+        eth_interface_params(architecture.get_eth_interface_params()),
+        host_address_params(architecture.get_host_address_params()),
+        noc_params(architecture.get_noc_params()),
+        engine(eth_interface_params, host_address_params, noc_params, profile),
+        emulator(eth_interface_params, host_address_params, noc_params, eth_cores) {}
+
+    RemoteTransferCores get_cores() { return {eth_cores, active_core, 0, 3}; }
+
+    tt_driver_eth_interface_params eth_interface_params;
+    tt_driver_host_address_params host_address_params;
+    tt_driver_noc_params noc_params;
+    TransferProfile profile;
+    std::vector<tt_cxy_pair> eth_cores = {
+        tt_cxy_pair(0, 1, 0), tt_cxy_pair(0, 2, 0), tt_cxy_pair(0, 3, 0), tt_cxy_pair(0, 4, 0)};
+    int active_core = 0;
+    RemoteTransferEngine engine;
+    EriscQueueEmulator emulator;
+};
+
+std::vector<std::unique_ptr<architecture_implementation>> get_architectures() {
+    std::vector<std::unique_ptr<architecture_implementation>> architectures;
+    architectures.push_back(std::make_unique<wormhole_implementation>());
+    architectures.push_back(std::make_unique<blackhole_implementation>());
+    return architectures;
+}
+
+std::vector<std::uint8_t> make_data(std::size_t size, std::uint8_t seed) {
+    std::vector<std::uint8_t> data(size);
+    for (std::size_t i = 0; i < size; i++) {
+        data[i] = static_cast<std::uint8_t>(i * 7 + seed);
+    }
+    return data;
+}
+
+const eth_coord_t REMOTE_CHIP = {0, 1, 0, 0, 0};
+const eth_coord_t OTHER_REMOTE_CHIP = {0, 1, 1, 0, 0};
+const tt_xy_pair REMOTE_CORE = tt_xy_pair(1, 2);
+
+}  // namespace
+
+TEST(RemoteTransferEngine, PipelinedWriteAndFlush) {
+    for (const auto& architecture : get_architectures()) {
+        SCOPED_TRACE(get_arch_str(architecture->get_architecture()));
+        RemoteTransferSetup setup(*architecture);
+        // Small blocks make the write take many more commands than fit in the queue of a single core.
+        setup.profile.remote_dram_block_size = 1024;
+        const std::vector<std::uint8_t> data = make_data(64 * 1024, 1);
+
+        const std::uint32_t eth_core_mask = setup.engine.write(
+            setup.emulator, setup.get_cores(), data.data(), data.size(), REMOTE_CHIP, REMOTE_CORE, 0x10000);
+        // The write moved on to the next core whenever a queue filled up, rather than wait for the firmware.
+        EXPECT_EQ(eth_core_mask, 0b1111);
+
+        setup.engine.wait_for_cores(setup.emulator, setup.eth_cores, eth_core_mask);
+        EXPECT_EQ(setup.emulator.get_unacknowledged_writes(), 0);
+        EXPECT_EQ(setup.emulator.read_remote(REMOTE_CHIP, REMOTE_CORE, 0x10000, data.size()), data);
+        for (std::size_t i = 0; i < setup.eth_cores.size(); i++) {
+            EXPECT_EQ(setup.engine.get_queue_occupancy(setup.emulator, setup.eth_cores[i]), 0);
+        }
+    }
+}
+
+TEST(RemoteTransferEngine, WriteAndRead) {
+    // Word commands for unaligned addresses, blocks in the L1 of the ethernet core, and blocks in host memory.
+    const std::vector<std::pair<std::uint64_t, std::uint32_t>> transfers = {
+        {0x1004, 7}, {0x2000, 3}, {0x3000, 1000}, {0x4010, 130}, {0x8000, 10000}, {0x20000, 100 * 1024 + 2}};
+    for (const auto& architecture : get_architectures()) {
+        SCOPED_TRACE(get_arch_str(architecture->get_architecture()));
+        RemoteTransferSetup setup(*architecture);
+        for (const auto& [address, size] : transfers) {
+            SCOPED_TRACE(address);
+            const std::vector<std::uint8_t> data = make_data(size, 3);
+            const std::vector<std::uint8_t> other_data = make_data(size, 5);
+            std::uint32_t eth_core_mask = setup.engine.write(
+                setup.emulator, setup.get_cores(), data.data(), size, REMOTE_CHIP, REMOTE_CORE, address);
+            eth_core_mask |= setup.engine.write(
+                setup.emulator, setup.get_cores(), other_data.data(), size, OTHER_REMOTE_CHIP, REMOTE_CORE, address);
+            setup.engine.wait_for_cores(setup.emulator, setup.eth_cores, eth_core_mask);
+
+            std::vector<std::uint8_t> readback(size);
+            setup.engine.read(
+                setup.emulator, setup.eth_cores[0], readback.data(), REMOTE_CHIP, REMOTE_CORE, address, size);
+            EXPECT_EQ(readback, data);
+            setup.engine.read(
+                setup.emulator, setup.eth_cores[0], readback.data(), OTHER_REMOTE_CHIP, REMOTE_CORE, address, size);
+            EXPECT_EQ(readback, other_data);
+        }
+    }
+}
+
+TEST(RemoteTransferEngine, ZeroCopyRead) {
+    for (const auto& architecture : get_architectures()) {
+        SCOPED_TRACE(get_arch_str(architecture->get_architecture()));
+        RemoteTransferSetup setup(*architecture);
+        const std::vector<std::uint8_t> data = make_data(96 * 1024, 9);
+        const std::uint32_t eth_core_mask = setup.engine.write(
+            setup.emulator, setup.get_cores(), data.data(), data.size(), REMOTE_CHIP, REMOTE_CORE, 0);
+        setup.engine.wait_for_cores(setup.emulator, setup.eth_cores, eth_core_mask);
+
+        // The firmware writes the data in place, nothing is copied out of the routing buffers.
+        const std::uint64_t sysmem_offset = setup.emulator.get_zero_copy_offset();
+        std::uint8_t* destination = setup.emulator.sysmem_ptr(sysmem_offset, data.size());
+        setup.engine.read(
+            setup.emulator,
+            setup.eth_cores[0],
+            destination,
+            REMOTE_CHIP,
+            REMOTE_CORE,
+            0,
+            data.size(),
+            sysmem_offset);
+        EXPECT_EQ(std::vector<std::uint8_t>(destination, destination + data.size()), data);
+    }
+}
+
+TEST(RemoteTransferEngine, SegmentedWriteAndRead) {
+    // Segment boundaries inside of words and blocks, an empty segment, and word commands for the unaligned tail.
+    const std::vector<std::size_t> segment_sizes = {1, 5, 0, 1000, 3, 40 * 1024, 7, 2};
+    const std::vector<std::uint64_t> addresses = {0x2000, 0x4004};
+    for (const auto& architecture : get_architectures()) {
+        SCOPED_TRACE(get_arch_str(architecture->get_architecture()));
+        RemoteTransferSetup setup(*architecture);
+        for (const std::uint64_t address : addresses) {
+            SCOPED_TRACE(address);
+            std::vector<std::vector<std::uint8_t>> pages;
+            std::vector<Span<const std::uint8_t>> source_segments;
+            std::vector<std::uint8_t> data;
+            for (std::size_t i = 0; i < segment_sizes.size(); i++) {
+                pages.push_back(make_data(segment_sizes[i], i));
+                data.insert(data.end(), pages.back().begin(), pages.back().end());
+            }
+            for (const auto& page : pages) {
+                source_segments.push_back(page);
+            }
+            SegmentList<const std::uint8_t> source(source_segments);
+            const std::uint32_t eth_core_mask =
+                setup.engine.write(setup.emulator, setup.get_cores(), source, REMOTE_CHIP, REMOTE_CORE, address);
+            setup.engine.wait_for_cores(setup.emulator, setup.eth_cores, eth_core_mask);
+
+            std::vector<std::uint8_t> readback(data.size());
+            setup.engine.read(
+                setup.emulator, setup.eth_cores[0], readback.data(), REMOTE_CHIP, REMOTE_CORE, address, data.size());
+            EXPECT_EQ(readback, data);
+
+            std::vector<std::vector<std::uint8_t>> readback_pages;
+            std::vector<Span<std::uint8_t>> destination_segments;
+            for (const std::size_t size : segment_sizes) {
+                readback_pages.emplace_back(size);
+            }
+            for (auto& page : readback_pages) {
+                destination_segments.push_back(page);
+            }
+            SegmentList<std::uint8_t> destination(destination_segments);
+            setup.engine.read(setup.emulator, setup.eth_cores[0], destination, REMOTE_CHIP, REMOTE_CORE, address);
+            EXPECT_EQ(readback_pages, pages);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "umd/device/session_record.h"
+
+using namespace tt::umd;
+
+namespace {
+
+// Far above the id of any real device.
+constexpr int pci_interface_id = 4243;
+
+// Starts a session in a child process, which exits without ending it once released.
+pid_t start_child_session(std::uint64_t fingerprint, int ready_pipe[2], int release_pipe[2]) {
+    pid_t pid = fork();
+    if (pid == 0) {
+        SessionRecord child_record(pci_interface_id);
+        child_record.begin_session(fingerprint);
+        char byte = 0;
+        (void)!write(ready_pipe[1], &byte, 1);
+        (void)!read(release_pipe[0], &byte, 1);
+        // Skips the destructors, like a crash.
+        _exit(0);
+    }
+    char byte = 0;
+    (void)!read(ready_pipe[0], &byte, 1);
+    return pid;
+}
+
+}  // namespace
+
+TEST(SessionRecord, Fingerprint) {
+    EXPECT_EQ(ConfigFingerprint().add(1).add("abc").get(), ConfigFingerprint().add(1).add("abc").get());
+    EXPECT_NE(ConfigFingerprint().add(1).add(2).get(), ConfigFingerprint().add(2).add(1).get());
+    EXPECT_NE(ConfigFingerprint().add("ab").add("c").get(), ConfigFingerprint().add("a").add("bc").get());
+}
+
+TEST(SessionRecord, ResumeAfterCleanShutdown) {
+    SessionRecord::remove(pci_interface_id);
+    {
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(1));
+        record.record_configuration(1, 0x60600);
+        record.end_session(true);
+    }
+    {
+        SessionRecord record(pci_interface_id);
+        EXPECT_TRUE(record.begin_session(1));
+        EXPECT_EQ(record.get_eth_fw_version(), 0x60600);
+        record.end_session(true);
+    }
+    {
+        // Configured differently, so it has to be initialized again.
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(2));
+        record.end_session(true);
+    }
+    {
+        // The process with the other configuration did not record one, so nothing can be resumed.
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(1));
+        record.record_configuration(1, 0x60600);
+        // Without a clean shutdown the device state is unknown.
+        record.end_session(false);
+    }
+    {
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(1));
+    }
+    SessionRecord::remove(pci_interface_id);
+}
+
+TEST(SessionRecord, InvalidatedConfiguration) {
+    SessionRecord::remove(pci_interface_id);
+    {
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(1));
+        record.record_configuration(1, 0x60600);
+        record.end_session(true);
+    }
+    {
+        // A resumed session which configures the device beyond its fingerprint cannot be resumed in turn.
+        SessionRecord record(pci_interface_id);
+        EXPECT_TRUE(record.begin_session(1));
+        record.invalidate_configuration();
+        record.end_session(true);
+    }
+    {
+        SessionRecord record(pci_interface_id);
+        EXPECT_FALSE(record.begin_session(1));
+    }
+    SessionRecord::remove(pci_interface_id);
+}
+
+TEST(SessionRecord, OtherProcesses) {
+    SessionRecord::remove(pci_interface_id);
+    SessionRecord record(pci_interface_id);
+    EXPECT_FALSE(record.begin_session(1));
+    record.record_configuration(1, 0);
+    record.end_session(true);
+
+    int ready_pipe[2];
+    int release_pipe[2];
+    ASSERT_EQ(pipe(ready_pipe), 0);
+    ASSERT_EQ(pipe(release_pipe), 0);
+    char byte = 0;
+
+    // A process which resumed the session and died without closing the device leaves its state unknown.
+    pid_t child = start_child_session(1, ready_pipe, release_pipe);
+    (void)!write(release_pipe[1], &byte, 1);
+    waitpid(child, nullptr, 0);
+    EXPECT_FALSE(record.begin_session(1));
+    record.record_configuration(1, 0);
+    record.end_session(true);
+
+    // A running process keeps others from resuming the session.
+    child = start_child_session(1, ready_pipe, release_pipe);
+    EXPECT_FALSE(record.begin_session(1));
+    record.record_configuration(1, 0);
+    (void)!write(release_pipe[1], &byte, 1);
+    waitpid(child, nullptr, 0);
+    // The slot of the dead process is freed, so this shutdown is the last one and the next session can resume.
+    record.end_session(true);
+    EXPECT_TRUE(record.begin_session(1));
+    record.end_session(true);
+
+    for (int fd : {ready_pipe[0], ready_pipe[1], release_pipe[0], release_pipe[1]}) {
+        close(fd);
+    }
+    SessionRecord::remove(pci_interface_id);
+}
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "gtest/gtest.h"
+#include "tests/test_utils/generate_cluster_desc.hpp"
+#include "umd/device/cluster.h"
+#include "umd/device/tt_soc_descriptor.h"
+
+using namespace tt::umd;
+
+namespace {
+
+// Checks the dense core tables against the public maps they are built from, for every core of the grid and one past it.
+void check_core_tables(const tt_SocDescriptor& soc_desc) {
+    for (std::size_t y = 0; y <= soc_desc.grid_size.y; y++) {
+        for (std::size_t x = 0; x <= soc_desc.grid_size.x; x++) {
+            const tt_xy_pair core(x, y);
+            const auto core_it = soc_desc.cores.find(core);
+            EXPECT_EQ(soc_desc.has(core), core_it != soc_desc.cores.end());
+            if (core_it != soc_desc.cores.end()) {
+                EXPECT_EQ(soc_desc.get_core_type(core), core_it->second.type);
+            } else {
+                EXPECT_THROW(soc_desc.get_core_type(core), std::out_of_range);
+            }
+
+            EXPECT_EQ(
+                soc_desc.is_worker_core(core),
+                soc_desc.routing_x_to_worker_x.count(x) && soc_desc.routing_y_to_worker_y.count(y));
+
+            const auto eth_it = soc_desc.ethernet_core_channel_map.find(core);
+            EXPECT_EQ(soc_desc.is_ethernet_core(core), eth_it != soc_desc.ethernet_core_channel_map.end());
+            if (eth_it != soc_desc.ethernet_core_channel_map.end()) {
+                EXPECT_EQ(soc_desc.get_ethernet_channel(core), eth_it->second);
+            }
+
+            const auto dram_it = soc_desc.dram_core_channel_map.find(core);
+            if (dram_it != soc_desc.dram_core_channel_map.end()) {
+                EXPECT_EQ(soc_desc.get_dram_channel(core), std::get<0>(dram_it->second));
+            } else {
+                EXPECT_THROW(soc_desc.get_dram_channel(core), std::out_of_range);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(SocDescriptor, CoreTablesMatchMaps) {
+    for (const auto& soc_desc_path :
+         {"tests/soc_descs/grayskull_10x12.yaml",
+          "tests/soc_descs/wormhole_b0_8x10.yaml",
+          "tests/soc_descs/blackhole_140_arch.yaml"}) {
+        tt_SocDescriptor soc_desc(test_utils::GetAbsPath(soc_desc_path));
+        check_core_tables(soc_desc);
+
+        tt_SocDescriptor soc_desc_copy(soc_desc);
+        check_core_tables(soc_desc_copy);
+    }
+}
+
+// Tests that the core tables follow the descriptor when harvested rows are removed from it.
+TEST(SocDescriptor, CoreTablesAfterHarvesting) {
+    tt_SocDescriptor soc_desc(test_utils::GetAbsPath("tests/soc_descs/wormhole_b0_8x10.yaml"));
+    const tt_xy_pair last_row_worker = soc_desc.workers.back();
+    ASSERT_TRUE(soc_desc.is_worker_core(last_row_worker));
+
+    // Wormhole always removes the last tensix rows from the descriptor, one row is harvested here.
+    Cluster::harvest_rows_in_soc_descriptor(tt::ARCH::WORMHOLE_B0, soc_desc, 0x2);
+    check_core_tables(soc_desc);
+    EXPECT_FALSE(soc_desc.is_worker_core(last_row_worker));
+    EXPECT_EQ(soc_desc.get_core_type(last_row_worker), CoreType::HARVESTED);
+}
+
+// Tests that lookups follow changes made directly to the public maps, without build_core_tables.
+TEST(SocDescriptor, CoreTablesAfterDirectChanges) {
+    tt_SocDescriptor soc_desc;
+    soc_desc.grid_size = tt_xy_pair(2, 3);
+    EXPECT_FALSE(soc_desc.has({1, 1}));
+
+    soc_desc.cores[{1, 1}] = CoreDescriptor{tt_xy_pair(1, 1), CoreType::WORKER};
+    soc_desc.routing_x_to_worker_x[1] = 0;
+    soc_desc.routing_y_to_worker_y[1] = 0;
+    soc_desc.cores[{0, 2}] = CoreDescriptor{tt_xy_pair(0, 2), CoreType::ETH};
+    soc_desc.ethernet_core_channel_map[{0, 2}] = 3;
+    check_core_tables(soc_desc);
+    EXPECT_TRUE(soc_desc.is_worker_core({1, 1}));
+    EXPECT_TRUE(soc_desc.is_ethernet_core({0, 2}));
+
+    soc_desc.cores.at({1, 1}).type = CoreType::HARVESTED;
+    soc_desc.ethernet_core_channel_map.at({0, 2}) = 4;
+    EXPECT_EQ(soc_desc.get_core_type({1, 1}), CoreType::HARVESTED);
+    EXPECT_EQ(soc_desc.get_ethernet_channel({0, 2}), 4);
+
+    soc_desc.ethernet_core_channel_map.erase({0, 2});
+    EXPECT_FALSE(soc_desc.is_ethernet_core({0, 2}));
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umd/device/span.h"
+
+using namespace tt::umd;
+
+TEST(Span, FromContainers) {
+    std::vector<uint32_t> vector = {1, 2, 3};
+    Span<uint32_t> writable(vector);
+    EXPECT_EQ(writable.data(), vector.data());
+    EXPECT_EQ(writable.size(), 3);
+    EXPECT_EQ(writable.size_bytes(), 12);
+    writable[1] = 5;
+    EXPECT_EQ(vector[1], 5);
+
+    const std::array<uint32_t, 2> array = {7, 8};
+    Span<const uint32_t> read_only(array);
+    EXPECT_EQ(std::vector<uint32_t>(read_only.begin(), read_only.end()), std::vector<uint32_t>({7, 8}));
+
+    // A writable span converts to a read only one.
+    Span<const uint32_t> from_span = writable;
+    EXPECT_EQ(from_span.data(), vector.data());
+    EXPECT_TRUE(Span<const uint32_t>().empty());
+}
+
+TEST(Span, Subspan) {
+    std::vector<uint8_t> data(10);
+    Span<uint8_t> span(data);
+
+    EXPECT_EQ(span.subspan(4).data(), data.data() + 4);
+    EXPECT_EQ(span.subspan(4).size(), 6);
+    EXPECT_EQ(span.subspan(4, 2).size(), 2);
+    EXPECT_TRUE(span.subspan(10).empty());
+    EXPECT_THROW(span.subspan(11), std::out_of_range);
+    EXPECT_THROW(span.subspan(4, 7), std::out_of_range);
+}
+
+TEST(Span, Bytes) {
+    std::vector<uint32_t> data = {0x04030201, 0x08070605};
+    Span<const uint8_t> bytes = as_bytes(data);
+    EXPECT_EQ(bytes.size(), 8);
+    EXPECT_EQ(static_cast<const void*>(bytes.data()), static_cast<const void*>(data.data()));
+
+    as_writable_bytes(Span<uint32_t>(data))[0] = 0xff;
+    EXPECT_EQ(data[0] & 0xff, 0xff);
+}
+
+TEST(SegmentList, Pieces) {
+    std::vector<uint8_t> first(3), second(0), third(5);
+    const std::vector<Span<uint8_t>> segments = {first, second, third};
+    SegmentList<uint8_t> list(segments);
+    EXPECT_EQ(list.size_bytes(), 8);
+
+    std::vector<std::pair<uint8_t*, std::size_t>> pieces;
+    std::vector<uint64_t> piece_offsets;
+    const auto record = [&](Span<uint8_t> piece, uint64_t piece_offset) {
+        pieces.push_back({piece.data(), piece.size()});
+        piece_offsets.push_back(piece_offset);
+    };
+
+    // A range across the empty segment is split at the segment boundary.
+    list.for_each_piece(1, 4, record);
+    EXPECT_EQ(pieces, (std::vector<std::pair<uint8_t*, std::size_t>>{{first.data() + 1, 2}, {third.data(), 2}}));
+    EXPECT_EQ(piece_offsets, (std::vector<uint64_t>{0, 2}));
+
+    // Ranges before the previous one are found as well.
+    pieces.clear();
+    piece_offsets.clear();
+    list.for_each_piece(6, 2, record);
+    list.for_each_piece(0, 1, record);
+    EXPECT_EQ(pieces, (std::vector<std::pair<uint8_t*, std::size_t>>{{third.data() + 3, 2}, {first.data(), 1}}));
+
+    EXPECT_THROW(list.for_each_piece(6, 3, record), std::out_of_range);
+}
+
+TEST(SegmentList, SingleSegment) {
+    std::vector<uint8_t> data(16);
+    SegmentList<uint8_t> list{Span<uint8_t>(data)};
+    EXPECT_EQ(list.size_bytes(), 16);
+    std::size_t pieces = 0;
+    list.for_each_piece(4, 12, [&](Span<uint8_t> piece, uint64_t piece_offset) {
+        EXPECT_EQ(piece.data(), data.data() + 4);
+        EXPECT_EQ(piece.size(), 12);
+        EXPECT_EQ(piece_offset, 0);
+        pieces++;
+    });
+    EXPECT_EQ(pieces, 1);
+}
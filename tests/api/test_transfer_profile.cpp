@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "umd/device/transfer_profile.h"
+
+using namespace tt::umd;
+
+TEST(TransferProfile, SaveAndLoad) {
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "umd_transfer_profile_test" / "profile.yaml").string();
+    std::filesystem::remove_all(std::filesystem::path(path).parent_path());
+
+    EXPECT_FALSE(TransferProfile::load(path, "Host A").has_value());
+
+    TransferProfile host_a;
+    host_a.host = "Host A";
+    host_a.remote_write_dram_threshold = 2048;
+    host_a.remote_read_dram_threshold = 512;
+    host_a.remote_dram_block_size = 512;
+    host_a.streaming_read_min_size = 256;
+    host_a.save(path);
+
+    TransferProfile host_b;
+    host_b.host = "Host B";
+    host_b.streaming_read_min_size = 64;
+    host_b.save(path);
+
+    // Replaces the first profile of host A, and keeps the one of host B.
+    host_a.remote_write_dram_threshold = 4096;
+    host_a.save(path);
+
+    EXPECT_EQ(TransferProfile::load(path, "Host A"), host_a);
+    EXPECT_EQ(TransferProfile::load(path, "Host B"), host_b);
+    EXPECT_FALSE(TransferProfile::load(path, "Host C").has_value());
+
+    std::filesystem::remove_all(std::filesystem::path(path).parent_path());
+}
+
+TEST(TransferProfile, MissingSettingsKeepDefaults) {
+    const std::string path = (std::filesystem::temp_directory_path() / "umd_transfer_profile_partial.yaml").string();
+    {
+        std::ofstream file(path);
+        file << "profiles:\n  - host: Host A\n    remote_read_dram_threshold: 4096\n";
+    }
+    const std::optional<TransferProfile> profile = TransferProfile::load(path, "Host A");
+    ASSERT_TRUE(profile.has_value());
+    TransferProfile expected;
+    expected.host = "Host A";
+    expected.remote_read_dram_threshold = 4096;
+    EXPECT_EQ(*profile, expected);
+
+    {
+        std::ofstream file(path);
+        file << "profiles: [ host: Host A\n";
+    }
+    EXPECT_THROW(TransferProfile::load(path, "Host A"), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(TransferProfile, FindCrossover) {
+    // The alternative wins from the third size on.
+    EXPECT_EQ(TransferProfile::find_crossover({1, 2, 3, 4}, {5, 5, 2, 3}), 2);
+    // A size where the alternative wins by chance before the crossover is ignored.
+    EXPECT_EQ(TransferProfile::find_crossover({1, 2, 3, 4}, {0, 5, 2, 3}), 2);
+    EXPECT_EQ(TransferProfile::find_crossover({1, 2, 3, 4}, {0, 1, 2, 3}), 0);
+    EXPECT_FALSE(TransferProfile::find_crossover({1, 2, 3, 4}, {0, 1, 2, 5}).has_value());
+    EXPECT_THROW(TransferProfile::find_crossover({1, 2}, {1}), std::runtime_error);
+}
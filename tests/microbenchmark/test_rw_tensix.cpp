@@ -136,3 +136,26 @@ TEST_F(uBenchmarkFixture, Read32BytesRandomAddr) {
     }
     bench.render(ankerl::nanobench::templates::csv(), results_csv);
 }
+
+TEST_F(uBenchmarkFixture, ReadSizeSweep) {
+    std::vector<uint32_t> readback_vec = {};
+    std::uint64_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+    tt_xy_pair core = device->get_virtual_soc_descriptors().at(0).workers.at(0);
+
+    // Sizes stay below the 1MB static TLB window, so every read goes through the WC mapped static TLB.
+    ankerl::nanobench::Bench bench;
+    for (std::uint32_t size = 4; size <= (512 << 10); size <<= 1) {
+        std::stringstream rname;
+        rname << "Read " << size << " bytes from device core (" << core.x << ", " << core.y << ")";
+        bench.title("Read size sweep")
+            .unit("byte")
+            .batch(size)
+            .minEpochIterations(50)
+            .output(nullptr)
+            .run(rname.str(), [&] {
+                test_utils::read_data_from_device(
+                    *device, readback_vec, tt_cxy_pair(0, core), address, size, "SMALL_READ_WRITE_TLB");
+            });
+    }
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
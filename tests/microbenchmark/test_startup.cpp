@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "device/mockup/tt_mockup_device.hpp"
+#include "nanobench.h"
+#include "tests/test_utils/generate_cluster_desc.hpp"
+#include "umd/device/cluster.h"
+#include "umd/device/pci_device.hpp"
+#include "umd/device/tt_cluster_descriptor.h"
+#include "umd/device/tt_soc_descriptor.h"
+
+using namespace tt::umd;
+
+// Startup steps which do not need devices, run against descriptor files and the mockup device.
+TEST(StartupBenchmark, OfflineStartup) {
+    std::ofstream results_csv("ubench_results.csv", std::ios_base::app);
+    ankerl::nanobench::Bench bench;
+    bench.title("Offline startup").unit("startup").minEpochIterations(10);
+
+    for (const std::string cluster_desc_yaml : {"wormhole_N300.yaml", "galaxy.yaml"}) {
+        const std::string cluster_desc_path =
+            test_utils::GetAbsPath("tests/api/cluster_descriptor_examples/" + cluster_desc_yaml);
+        bench.run("Load cluster descriptor " + cluster_desc_yaml, [&] {
+            ankerl::nanobench::doNotOptimizeAway(tt_ClusterDescriptor::create_from_yaml(cluster_desc_path));
+        });
+    }
+
+    bench.run("Create mock cluster descriptor", [&] {
+        ankerl::nanobench::doNotOptimizeAway(tt_ClusterDescriptor::create_mock_cluster({0}, tt::ARCH::WORMHOLE_B0));
+    });
+
+    for (const std::string soc_desc_yaml :
+         {"grayskull_10x12.yaml", "wormhole_b0_8x10.yaml", "blackhole_140_arch.yaml"}) {
+        const std::string soc_desc_path = test_utils::GetAbsPath("tests/soc_descs/" + soc_desc_yaml);
+        bench.run("Parse SoC descriptor " + soc_desc_yaml, [&] {
+            ankerl::nanobench::doNotOptimizeAway(tt_SocDescriptor(soc_desc_path));
+        });
+        bench.run("Create mockup device " + soc_desc_yaml, [&] {
+            ankerl::nanobench::doNotOptimizeAway(std::make_unique<tt_MockupDevice>(soc_desc_path));
+        });
+    }
+
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
+
+// Phases of bringing up the cluster on silicon, as recorded by the cluster itself.
+TEST(StartupBenchmark, ClusterStartupPhases) {
+    if (PCIDevice::enumerate_devices().empty()) {
+        GTEST_SKIP() << "No chips present on the system.";
+    }
+
+    std::unique_ptr<Cluster> cluster = std::make_unique<Cluster>();
+    tt_device_params default_params;
+    cluster->start_device(default_params);
+
+    std::ofstream phases_csv("startup_phases.csv");
+    phases_csv << "phase,depth,duration_ms" << std::endl;
+    for (const auto& phase : cluster->get_startup_phases()) {
+        phases_csv << '"' << phase.name << "\"," << phase.depth << ","
+                   << std::chrono::duration<double, std::milli>(phase.duration).count() << std::endl;
+    }
+    cluster->close_device();
+}
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: (c) 2024 Tenstorrent Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "nanobench.h"
+#include "tests/test_utils/generate_cluster_desc.hpp"
+#include "umd/device/cluster.h"
+#include "umd/device/tt_cluster_descriptor.h"
+
+using tt::umd::Cluster;
+
+// Host side cost of the cluster topology algorithms on synthetic Galaxy clusters, from a single shelf up to a few
+// thousand chips. None of these need devices.
+
+namespace {
+
+struct ScalingTopology {
+    std::string name;
+    test_utils::GalaxyTopology topology;
+};
+
+// tt_ClusterDescriptor follows rack links only on the shelf they are on, so a topology scales either its racks or its
+// shelves.
+ScalingTopology make_scaling_topology(int num_racks, int num_shelves) {
+    if (num_racks > 1 && num_shelves > 1) {
+        throw std::invalid_argument(
+            fmt::format("Scaling topologies can't have both {} racks and {} shelves.", num_racks, num_shelves));
+    }
+    ScalingTopology scaling_topology;
+    scaling_topology.topology.num_racks = num_racks;
+    scaling_topology.topology.num_shelves = num_shelves;
+    scaling_topology.topology.mmio_chips_per_shelf = 4;
+    scaling_topology.topology.harvesting_masks = {0, 0, 0, 1};
+    const int num_chips = num_racks * num_shelves * test_utils::GALAXY_SHELF_X_SIZE * test_utils::GALAXY_SHELF_Y_SIZE;
+    scaling_topology.name = num_racks > 1 ? fmt::format("{} racks ({} chips)", num_racks, num_chips)
+                                          : fmt::format("{} shelves ({} chips)", num_shelves, num_chips);
+    return scaling_topology;
+}
+
+std::vector<ScalingTopology> get_scaling_topologies() {
+    std::vector<ScalingTopology> topologies = {};
+    for (int num_shelves : {1, 4, 16, 64}) {
+        topologies.push_back(make_scaling_topology(1, num_shelves));
+    }
+    for (int num_racks : {4, 16, 64}) {
+        topologies.push_back(make_scaling_topology(num_racks, 1));
+    }
+    return topologies;
+}
+
+std::string generate_cluster_desc(const ScalingTopology& scaling_topology) {
+    const std::string file_name = fmt::format(
+        "umd_ubench_galaxy_{}_{}.yaml", scaling_topology.topology.num_racks, scaling_topology.topology.num_shelves);
+    return test_utils::generate_galaxy_cluster_desc(
+        scaling_topology.topology, (std::filesystem::temp_directory_path() / file_name).string());
+}
+
+std::vector<std::pair<chip_id_t, chip_id_t>> generate_random_chip_pairs(std::size_t num_chips, std::size_t num_pairs) {
+    ankerl::nanobench::Rng gen(80085);
+    std::vector<std::pair<chip_id_t, chip_id_t>> pairs = {};
+    for (std::size_t i = 0; i < num_pairs; i++) {
+        pairs.push_back({gen.bounded(num_chips), gen.bounded(num_chips)});
+    }
+    return pairs;
+}
+
+}  // namespace
+
+class tt_ClusterDescriptorTestAccess {
+public:
+    // Makes the next lookups do the full search again.
+    static void clear_closest_mmio_chip_cache(tt_ClusterDescriptor& cluster_desc) {
+        cluster_desc.closest_mmio_chip_cache.clear();
+    }
+};
+
+TEST(TopologyScaling, LoadClusterDescriptor) {
+    std::ofstream results_csv("ubench_results.csv", std::ios_base::app);
+    ankerl::nanobench::Bench bench;
+    bench.title("Load cluster descriptor").unit("load").epochs(3).epochIterations(1);
+    for (const auto& scaling_topology : get_scaling_topologies()) {
+        const std::string cluster_desc_path = generate_cluster_desc(scaling_topology);
+        bench.run(scaling_topology.name, [&] {
+            ankerl::nanobench::doNotOptimizeAway(tt_ClusterDescriptor::create_from_yaml(cluster_desc_path));
+        });
+        std::filesystem::remove(cluster_desc_path);
+    }
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
+
+TEST(TopologyScaling, ClosestMmioCapableChip) {
+    std::ofstream results_csv("ubench_results.csv", std::ios_base::app);
+    ankerl::nanobench::Bench bench;
+    bench.title("Closest MMIO capable chip, uncached").unit("lookup").minEpochIterations(10);
+    for (const auto& scaling_topology : get_scaling_topologies()) {
+        const std::string cluster_desc_path = generate_cluster_desc(scaling_topology);
+        std::unique_ptr<tt_ClusterDescriptor> cluster_desc = tt_ClusterDescriptor::create_from_yaml(cluster_desc_path);
+        std::filesystem::remove(cluster_desc_path);
+
+        const std::size_t num_chips = cluster_desc->get_number_of_chips();
+        ankerl::nanobench::Rng gen(80085);
+        bench.run(scaling_topology.name, [&] {
+            tt_ClusterDescriptorTestAccess::clear_closest_mmio_chip_cache(*cluster_desc);
+            ankerl::nanobench::doNotOptimizeAway(cluster_desc->get_closest_mmio_capable_chip(gen.bounded(num_chips)));
+        });
+    }
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
+
+TEST(TopologyScaling, EthernetLinkDistance) {
+    std::ofstream results_csv("ubench_results.csv", std::ios_base::app);
+    ankerl::nanobench::Bench bench;
+    bench.title("Ethernet link distance").unit("distance").minEpochIterations(10);
+    for (const auto& scaling_topology : get_scaling_topologies()) {
+        const std::string cluster_desc_path = generate_cluster_desc(scaling_topology);
+        std::unique_ptr<tt_ClusterDescriptor> cluster_desc = tt_ClusterDescriptor::create_from_yaml(cluster_desc_path);
+        std::filesystem::remove(cluster_desc_path);
+
+        const auto chip_pairs = generate_random_chip_pairs(cluster_desc->get_number_of_chips(), 1000);
+        bench.batch(chip_pairs.size()).run(scaling_topology.name, [&] {
+            for (const auto& [chip_a, chip_b] : chip_pairs) {
+                ankerl::nanobench::doNotOptimizeAway(cluster_desc->get_ethernet_link_distance(chip_a, chip_b));
+            }
+        });
+    }
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
+
+TEST(TopologyScaling, EthernetBroadcastHeaders) {
+    std::ofstream results_csv("ubench_results.csv", std::ios_base::app);
+    ankerl::nanobench::Bench bench;
+    bench.title("Ethernet broadcast headers").unit("header set").minEpochIterations(10);
+    for (const auto& scaling_topology : get_scaling_topologies()) {
+        // Broadcast headers encode shelves as bits of a byte and racks in the first three header words.
+        if (scaling_topology.topology.num_shelves > 8 || scaling_topology.topology.num_racks > 12) {
+            continue;
+        }
+        const std::string cluster_desc_path = generate_cluster_desc(scaling_topology);
+        std::unique_ptr<tt_ClusterDescriptor> cluster_desc = tt_ClusterDescriptor::create_from_yaml(cluster_desc_path);
+        std::filesystem::remove(cluster_desc_path);
+
+        const std::set<chip_id_t> target_devices(
+            cluster_desc->get_all_chips().begin(), cluster_desc->get_all_chips().end());
+        chip_id_t first_mmio_chip = std::numeric_limits<chip_id_t>::max();
+        for (const auto& [chip, _] : cluster_desc->get_chips_with_mmio()) {
+            first_mmio_chip = std::min(first_mmio_chip, chip);
+        }
+        bench.run(scaling_topology.name, [&] {
+            ankerl::nanobench::doNotOptimizeAway(
+                Cluster::generate_ethernet_broadcast_headers(cluster_desc.get(), target_devices, first_mmio_chip, {}));
+        });
+    }
+    bench.render(ankerl::nanobench::templates::csv(), results_csv);
+}
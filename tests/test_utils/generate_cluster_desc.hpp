@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "fmt/core.h"
 
@@ -29,4 +33,118 @@ inline std::string GetAbsPath(std::string path_) {
     std::filesystem::path abs_path = umd_root / path_;
     return abs_path.string();
 }
+
+// Synthetic Galaxy cluster made of 4x8 Wormhole shelves. Shelves of a rack are daisy chained through every row, racks
+// are daisy chained through every column of their first shelf.
+struct GalaxyTopology {
+    int num_racks = 1;
+    int num_shelves = 1;
+    // MMIO capable chips on each shelf, placed in column 0 and spread evenly over the rows.
+    int mmio_chips_per_shelf = 1;
+    // Assigned to the chips round robin, in chip id order.
+    std::vector<std::uint32_t> harvesting_masks = {0};
+};
+
+constexpr int GALAXY_SHELF_X_SIZE = 4;
+constexpr int GALAXY_SHELF_Y_SIZE = 8;
+
+inline int get_galaxy_chip_id(const GalaxyTopology& topology, int x, int y, int rack, int shelf) {
+    return ((rack * topology.num_shelves + shelf) * GALAXY_SHELF_Y_SIZE + y) * GALAXY_SHELF_X_SIZE + x;
+}
+
+// Writes a cluster descriptor yaml for the topology to file_path and returns the path.
+inline std::string generate_galaxy_cluster_desc(const GalaxyTopology& topology, const std::string& file_path) {
+    // tt_ClusterDescriptor follows rack links only on the shelf they are on, so racks can't have more than one shelf.
+    if (topology.num_racks < 1 || topology.num_shelves < 1 || (topology.num_racks > 1 && topology.num_shelves > 1)) {
+        throw std::invalid_argument(fmt::format(
+            "Unsupported Galaxy topology with {} racks of {} shelves.", topology.num_racks, topology.num_shelves));
+    }
+    if (topology.mmio_chips_per_shelf < 1 || topology.mmio_chips_per_shelf > GALAXY_SHELF_Y_SIZE) {
+        throw std::invalid_argument(
+            fmt::format("Unsupported number of MMIO chips per shelf {}.", topology.mmio_chips_per_shelf));
+    }
+
+    std::string arch = "arch: {\n";
+    std::string chips = "chips: {\n";
+    std::string harvesting = "harvesting: {\n";
+    std::string boardtype = "boardtype: {\n";
+    std::string ethernet_connections = "ethernet_connections: [\n";
+    std::string chips_with_mmio = "chips_with_mmio: [\n";
+
+    // Each link uses four consecutive channels on both ends.
+    auto add_link = [&](int chip_a, int first_chan_a, int chip_b, int first_chan_b) {
+        for (int i = 0; i < 4; i++) {
+            ethernet_connections += fmt::format(
+                "   [{{chip: {}, chan: {}}}, {{chip: {}, chan: {}}}],\n",
+                chip_a,
+                first_chan_a + i,
+                chip_b,
+                first_chan_b + i);
+        }
+    };
+
+    int pci_device_id = 0;
+    for (int rack = 0; rack < topology.num_racks; rack++) {
+        for (int shelf = 0; shelf < topology.num_shelves; shelf++) {
+            for (int y = 0; y < GALAXY_SHELF_Y_SIZE; y++) {
+                for (int x = 0; x < GALAXY_SHELF_X_SIZE; x++) {
+                    const int chip = get_galaxy_chip_id(topology, x, y, rack, shelf);
+                    arch += fmt::format("   {}: Wormhole,\n", chip);
+                    chips += fmt::format("   {}: [{},{},{},{}],\n", chip, x, y, rack, shelf);
+                    harvesting += fmt::format(
+                        "   {}: {{noc_translation: true, harvest_mask: {}}},\n",
+                        chip,
+                        topology.harvesting_masks.at(chip % topology.harvesting_masks.size()));
+                    boardtype += fmt::format("   {}: GALAXY,\n", chip);
+
+                    // Same channel layout as tests/api/cluster_descriptor_examples/galaxy.yaml: channels 12-15 lead to
+                    // x + 1, 4-7 to x - 1, and rows alternate between channels 0-3 and 8-11.
+                    if (x + 1 < GALAXY_SHELF_X_SIZE) {
+                        add_link(chip, 12, get_galaxy_chip_id(topology, x + 1, y, rack, shelf), 4);
+                    }
+                    if (y + 1 < GALAXY_SHELF_Y_SIZE) {
+                        const int first_chan = y % 2 == 0 ? 0 : 8;
+                        add_link(chip, first_chan, get_galaxy_chip_id(topology, x, y + 1, rack, shelf), first_chan);
+                    }
+                }
+                // Last column of each row is the exit to the first column of the same row on the next shelf.
+                if (shelf + 1 < topology.num_shelves) {
+                    add_link(
+                        get_galaxy_chip_id(topology, GALAXY_SHELF_X_SIZE - 1, y, rack, shelf),
+                        12,
+                        get_galaxy_chip_id(topology, 0, y, rack, shelf + 1),
+                        4);
+                }
+            }
+            // Last row of each column is the exit to the first row of the same column on the next rack.
+            if (rack + 1 < topology.num_racks) {
+                for (int x = 0; x < GALAXY_SHELF_X_SIZE; x++) {
+                    add_link(
+                        get_galaxy_chip_id(topology, x, GALAXY_SHELF_Y_SIZE - 1, rack, shelf),
+                        8,
+                        get_galaxy_chip_id(topology, x, 0, rack + 1, shelf),
+                        8);
+                }
+            }
+            for (int i = 0; i < topology.mmio_chips_per_shelf; i++) {
+                const int y = i * GALAXY_SHELF_Y_SIZE / topology.mmio_chips_per_shelf;
+                chips_with_mmio +=
+                    fmt::format("   {}: {},\n", get_galaxy_chip_id(topology, 0, y, rack, shelf), pci_device_id++);
+            }
+        }
+    }
+
+    std::ofstream cluster_desc(file_path);
+    if (cluster_desc.fail()) {
+        throw std::runtime_error(fmt::format("Could not open {} for writing.", file_path));
+    }
+    cluster_desc << arch << "}\n\n"
+                 << chips << "}\n\n"
+                 << ethernet_connections << "]\n\n"
+                 << chips_with_mmio << "]\n\n"
+                 << harvesting << "}\n\n"
+                 << boardtype << "}\n";
+    cluster_desc.close();
+    return file_path;
+}
 }  // namespace test_utils
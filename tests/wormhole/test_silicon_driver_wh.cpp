@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: (c) 2023 Tenstorrent Inc.
 //
 // SPDX-License-Identifier: Apache-2.0
+#include <filesystem>
 #include <memory>
+#include <numeric>
 #include <thread>
 
 #include "eth_l1_address_map.h"
@@ -985,3 +987,508 @@ TEST(SiliconDriverWH, LargeAddressTlb) {
     EXPECT_EQ(value1, value0);
     EXPECT_EQ(value2, value0);
 }
+
+TEST(SiliconDriverWH, BarRegisterBatch) {
+    const size_t num_channels = 1;
+    auto target_devices = get_target_devices();
+
+    Cluster cluster(
+        test_utils::GetAbsPath("tests/soc_descs/wormhole_b0_8x10.yaml"),
+        target_devices,
+        num_channels,
+        false,  // skip driver allocs - no (don't skip)
+        true,   // clean system resources - yes
+        true);  // perform harvesting - yes
+
+    // ARC reset unit scratch registers, as in LargeAddressTlb.
+    const uint32_t scratch_0 = 0x1ff30060;
+    const uint32_t scratch_1 = 0x1ff30064;
+
+    std::vector<uint32_t> values =
+        cluster.bar_batch32(0, {reg_batch_op::read(scratch_0), reg_batch_op::read(scratch_1)});
+
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0], cluster.bar_read32(0, scratch_0));
+    EXPECT_EQ(values[1], cluster.bar_read32(0, scratch_1));
+}
+
+TEST(SiliconDriverWH, BroadcastFill) {
+    // Fill a range larger than a fill chunk on all workers and DRAM channels, with a pattern which does not divide the
+    // chunk size, and verify every chip reads it back.
+    std::set<chip_id_t> target_devices = get_target_devices();
+
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    const std::vector<uint8_t> pattern = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77};
+    const uint32_t fill_size = Cluster::FILL_CHUNK_SIZE + 1000;
+    const uint32_t l1_fill_size = 64 * 1024;
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+    std::vector<uint8_t> expected(fill_size);
+    for (uint32_t i = 0; i < fill_size; i++) {
+        expected[i] = pattern[i % pattern.size()];
+    }
+
+    const auto& soc_descriptor = device.get_virtual_soc_descriptors().at(*target_devices.begin());
+    CoreSet workers = {};
+    for (const auto& core : soc_descriptor.workers) {
+        workers.insert(core);
+    }
+    device.broadcast_fill_cluster(
+        pattern.data(), pattern.size(), l1_fill_size, address, {}, workers, "LARGE_WRITE_TLB");
+    const std::unordered_set<uint32_t> all_dram_channels = {};
+    device.broadcast_fill_cluster(
+        pattern.data(), pattern.size(), fill_size, address, {}, all_dram_channels, "LARGE_WRITE_TLB");
+    device.wait_for_non_mmio_flush();
+
+    for (const auto chip : target_devices) {
+        std::vector<uint8_t> readback(fill_size);
+        for (const auto& core : device.get_virtual_soc_descriptors().at(chip).workers) {
+            device.read_from_device(readback.data(), tt_cxy_pair(chip, core), address, l1_fill_size, "LARGE_READ_TLB");
+            ASSERT_TRUE(std::equal(expected.begin(), expected.begin() + l1_fill_size, readback.begin()))
+                << "Fill pattern not found on chip " << chip << " core " << core.str();
+        }
+        for (int chan = 0; chan < device.get_virtual_soc_descriptors().at(chip).get_num_dram_channels(); chan++) {
+            const auto& core = device.get_virtual_soc_descriptors().at(chip).get_core_for_dram_channel(chan, 0);
+            device.read_from_device(readback.data(), tt_cxy_pair(chip, core), address, fill_size, "LARGE_READ_TLB");
+            ASSERT_EQ(expected, readback) << "Fill pattern not found on chip " << chip << " DRAM channel " << chan;
+        }
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, GatherRead) {
+    // Write a distinct vector to every worker of every chip, and gather all of them with a single read.
+    std::set<chip_id_t> target_devices = get_target_devices();
+
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    const uint32_t words_per_core = 64;
+    const uint32_t size_per_core = words_per_core * sizeof(uint32_t);
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+
+    const auto& soc_descriptor = device.get_virtual_soc_descriptors().at(*target_devices.begin());
+    CoreSet workers = {};
+    for (const auto& core : soc_descriptor.workers) {
+        workers.insert(core);
+    }
+
+    std::vector<uint32_t> expected = {};
+    for (const auto chip : target_devices) {
+        for (const auto& core : workers) {
+            std::vector<uint32_t> data(words_per_core);
+            for (uint32_t i = 0; i < words_per_core; i++) {
+                data[i] = (chip << 24) | (core.x << 16) | (core.y << 8) | i;
+            }
+            device.write_to_device(
+                data.data(), size_per_core, tt_cxy_pair(chip, core), address, "SMALL_READ_WRITE_TLB");
+            expected.insert(expected.end(), data.begin(), data.end());
+        }
+    }
+    device.wait_for_non_mmio_flush();
+
+    std::vector<uint32_t> gathered(expected.size());
+    device.gather_read_from_cluster(gathered.data(), target_devices, workers, address, size_per_core, "LARGE_READ_TLB");
+    ASSERT_EQ(expected, gathered);
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, ScatterWrite) {
+    // Write a different payload to every worker of every chip with a single call, then read each one back.
+    std::set<chip_id_t> target_devices = get_target_devices();
+
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    const uint32_t words_per_core = 1024;
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+
+    std::vector<std::vector<uint32_t>> payloads = {};
+    std::vector<tt_scatter_write> writes = {};
+    for (const auto chip : target_devices) {
+        for (const auto& core : device.get_virtual_soc_descriptors().at(chip).workers) {
+            std::vector<uint32_t> payload(words_per_core);
+            for (uint32_t i = 0; i < words_per_core; i++) {
+                payload[i] = (chip << 24) | (core.x << 16) | (core.y << 8) | (i & 0xff);
+            }
+            payloads.push_back(std::move(payload));
+            writes.push_back(
+                {payloads.back().data(), words_per_core * sizeof(uint32_t), tt_cxy_pair(chip, core), address});
+        }
+    }
+    device.scatter_write_to_cluster(writes, "LARGE_WRITE_TLB");
+
+    std::vector<uint32_t> readback(words_per_core);
+    for (std::size_t i = 0; i < writes.size(); i++) {
+        device.read_from_device(readback.data(), writes[i].core, address, writes[i].size_in_bytes, "LARGE_READ_TLB");
+        ASSERT_EQ(payloads[i], readback) << "Payload not found on " << writes[i].core.str();
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, ThreadPerChip) {
+    // Drive every chip from its own thread with plain, posted and remote writes, flushes and barriers, without any
+    // locking in the test.
+    std::set<chip_id_t> target_devices = get_target_devices();
+
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    std::vector<std::thread> threads = {};
+    for (const auto chip : target_devices) {
+        threads.emplace_back([&device, chip] {
+            const bool is_mmio_chip = device.get_cluster_description()->is_chip_mmio_capable(chip);
+            std::vector<uint32_t> readback_vec = {};
+            for (int loop = 0; loop < 10; loop++) {
+                std::uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+                for (const auto& core : device.get_virtual_soc_descriptors().at(chip).workers) {
+                    const std::vector<uint32_t> vector_to_write(16, (chip << 16) | (loop << 8) | core.x);
+                    const uint32_t size = vector_to_write.size() * sizeof(uint32_t);
+                    device.write_to_device_posted(
+                        vector_to_write.data(), size, tt_cxy_pair(chip, core), address, "SMALL_READ_WRITE_TLB");
+                    device.posted_write_barrier(chip);
+                    test_utils::read_data_from_device(
+                        device, readback_vec, tt_cxy_pair(chip, core), address, size, "SMALL_READ_WRITE_TLB");
+                    ASSERT_EQ(vector_to_write, readback_vec) << "Mismatch on chip " << chip << " core " << core.str();
+                    readback_vec = {};
+                    address += size;
+                }
+                if (!is_mmio_chip) {
+                    device.wait_for_non_mmio_flush(chip);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, ResumeSession) {
+    // The second cluster takes over the devices as the first one left them, and they are still usable.
+    std::set<chip_id_t> target_devices = get_target_devices();
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    tt_device_params default_params;
+    {
+        Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+        set_params_for_remote_txn(device);
+        device.start_device(default_params);
+        EXPECT_FALSE(device.is_session_resumed());
+        device.close_device();
+    }
+
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, false, true);
+    set_params_for_remote_txn(device);
+    tt_device_params resume_params;
+    resume_params.resume_session = true;
+    device.start_device(resume_params);
+    // Clusters with remote chips are always initialized again, and have to be usable just the same.
+    EXPECT_EQ(device.is_session_resumed(), device.get_target_remote_device_ids().empty());
+    device.deassert_risc_reset();
+
+    std::vector<uint32_t> vector_to_write = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<uint32_t> readback_vec = {};
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+    for (const auto chip : target_devices) {
+        for (const auto& core : device.get_virtual_soc_descriptors().at(chip).workers) {
+            device.write_to_device(
+                vector_to_write.data(),
+                vector_to_write.size() * sizeof(std::uint32_t),
+                tt_cxy_pair(chip, core),
+                address,
+                "SMALL_READ_WRITE_TLB");
+            device.wait_for_non_mmio_flush();
+            test_utils::read_data_from_device(
+                device, readback_vec, tt_cxy_pair(chip, core), address, 40, "SMALL_READ_WRITE_TLB");
+            ASSERT_EQ(vector_to_write, readback_vec) << "Mismatch on chip " << chip << " core " << core.str();
+            readback_vec = {};
+        }
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, CalibrateTransfers) {
+    // Calibrate the transfer settings of this host, and check that transfers of all sizes still arrive with them.
+    std::set<chip_id_t> target_devices = get_target_devices();
+
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+    const TransferProfile previous_profile = device.get_transfer_profile();
+    const TransferProfile profile = device.calibrate_transfers(address);
+    EXPECT_EQ(device.get_transfer_profile(), previous_profile);
+    EXPECT_EQ(profile.host, previous_profile.host);
+    EXPECT_EQ(profile.remote_dram_block_size % 32, 0);
+    device.set_transfer_profile(profile);
+
+    for (const auto chip : target_devices) {
+        const tt_cxy_pair core(chip, device.get_virtual_soc_descriptors().at(chip).workers.at(0));
+        for (uint32_t size = 4; size <= Cluster::TRANSFER_CALIBRATION_SIZE; size *= 4) {
+            std::vector<uint32_t> vector_to_write(size / sizeof(uint32_t));
+            for (uint32_t i = 0; i < vector_to_write.size(); i++) {
+                vector_to_write[i] = (chip << 24) | i;
+            }
+            std::vector<uint32_t> readback_vec(vector_to_write.size());
+            device.write_to_device(vector_to_write.data(), size, core, address, "LARGE_WRITE_TLB");
+            device.wait_for_non_mmio_flush();
+            device.read_from_device(readback_vec.data(), core, address, size, "LARGE_READ_TLB");
+            ASSERT_EQ(vector_to_write, readback_vec) << "Mismatch for " << size << " bytes on chip " << chip;
+        }
+    }
+    device.close_device();
+
+    const std::string path = (std::filesystem::temp_directory_path() / "umd_calibrated_profile.yaml").string();
+    profile.save(path);
+    EXPECT_EQ(TransferProfile::load(path, profile.host), profile);
+    std::filesystem::remove(path);
+}
+
+TEST(SiliconDriverWH, RemoteMembars) {
+    // Barriers on remote chips go through the barrier flags of the cores, and leave them reset.
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    const uint32_t address = l1_mem::address_map::DATA_BUFFER_SPACE_BASE;
+    std::vector<uint32_t> readback_vec = {};
+    for (const auto chip : device.get_target_remote_device_ids()) {
+        const auto& sdesc = device.get_virtual_soc_descriptors().at(chip);
+        for (const auto& core : sdesc.workers) {
+            const std::vector<uint32_t> vector_to_write(256, (chip << 16) | (core.x << 8) | core.y);
+            device.write_to_device(
+                vector_to_write.data(),
+                vector_to_write.size() * sizeof(uint32_t),
+                tt_cxy_pair(chip, core),
+                address,
+                "LARGE_WRITE_TLB");
+            device.l1_membar(chip, "LARGE_WRITE_TLB", {core});
+            test_utils::read_data_from_device(
+                device, readback_vec, tt_cxy_pair(chip, core), address, 256 * sizeof(uint32_t), "LARGE_READ_TLB");
+            ASSERT_EQ(readback_vec, vector_to_write);
+            readback_vec = {};
+
+            test_utils::read_data_from_device(
+                device,
+                readback_vec,
+                tt_cxy_pair(chip, core),
+                l1_mem::address_map::L1_BARRIER_BASE,
+                4,
+                "LARGE_READ_TLB");
+            ASSERT_EQ(readback_vec.at(0), 187);
+            readback_vec = {};
+        }
+
+        device.dram_membar(chip, "LARGE_WRITE_TLB", std::unordered_set<uint32_t>{0});
+        test_utils::read_data_from_device(
+            device, readback_vec, tt_cxy_pair(chip, sdesc.get_core_for_dram_channel(0, 0)), 0, 4, "LARGE_READ_TLB");
+        ASSERT_EQ(readback_vec.at(0), 187);
+        readback_vec = {};
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, SpanTransfers) {
+    // A buffer spanning many dynamic TLB windows moves in one call on MMIO chips, and in one call through the ethernet
+    // routing blocks on remote chips.
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    for (const auto chip : device.get_all_chips_in_cluster()) {
+        const bool is_remote = device.get_target_remote_device_ids().count(chip) > 0;
+        const std::size_t num_words = (is_remote ? 4 << 20 : 64 << 20) / sizeof(uint32_t);
+        std::vector<uint32_t> vector_to_write(num_words);
+        for (std::size_t i = 0; i < num_words; i++) {
+            vector_to_write[i] = (chip << 28) | i;
+        }
+        const tt_cxy_pair core(chip, device.get_virtual_soc_descriptors().at(chip).get_core_for_dram_channel(0, 0));
+        device.write_to_device(as_bytes(vector_to_write), core, 0, "LARGE_WRITE_TLB");
+        device.wait_for_non_mmio_flush();
+
+        std::vector<uint32_t> readback_vec(num_words);
+        device.read_from_device(as_writable_bytes(readback_vec), core, 0, "LARGE_READ_TLB");
+        ASSERT_EQ(vector_to_write, readback_vec) << "Mismatch on chip " << chip;
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, SegmentedTransfers) {
+    // Pages of different sizes land back to back in DRAM, and are read back into pages of other sizes.
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+    set_params_for_remote_txn(device);
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+    device.deassert_risc_reset();
+
+    // Pages of 1 and 2 bytes share a device word with their neighbours.
+    const std::vector<std::size_t> write_page_sizes = {4096, 3, 1, 2, 1 << 20, 0, 17, 64 << 10};
+    // The last read page holds the rest of the data.
+    const std::vector<std::size_t> read_page_sizes = {1, 5000, 1 << 19};
+    for (const auto chip : device.get_all_chips_in_cluster()) {
+        const tt_cxy_pair core(chip, device.get_virtual_soc_descriptors().at(chip).get_core_for_dram_channel(0, 0));
+
+        std::vector<std::vector<uint8_t>> write_pages;
+        std::vector<Span<const uint8_t>> write_segments;
+        std::vector<uint8_t> data;
+        for (const std::size_t size : write_page_sizes) {
+            write_pages.emplace_back(size);
+            for (std::size_t i = 0; i < size; i++) {
+                write_pages.back()[i] = static_cast<uint8_t>(chip + write_pages.size() + i * 3);
+            }
+            data.insert(data.end(), write_pages.back().begin(), write_pages.back().end());
+        }
+        for (const auto& page : write_pages) {
+            write_segments.push_back(page);
+        }
+        device.write_segments_to_device(write_segments, core, 0x100, "LARGE_WRITE_TLB");
+        device.wait_for_non_mmio_flush();
+
+        std::vector<uint8_t> readback(data.size());
+        device.read_from_device(as_writable_bytes(readback), core, 0x100, "LARGE_READ_TLB");
+        ASSERT_EQ(data, readback) << "Mismatch on chip " << chip;
+
+        std::vector<std::vector<uint8_t>> read_pages;
+        std::vector<Span<uint8_t>> read_segments;
+        for (const std::size_t size : read_page_sizes) {
+            read_pages.emplace_back(size);
+        }
+        read_pages.emplace_back(
+            data.size() - std::accumulate(read_page_sizes.begin(), read_page_sizes.end(), std::size_t{0}));
+        for (auto& page : read_pages) {
+            read_segments.push_back(page);
+        }
+        device.read_segments_from_device(read_segments, core, 0x100, "LARGE_READ_TLB");
+        std::vector<uint8_t> concatenated;
+        for (const auto& page : read_pages) {
+            concatenated.insert(concatenated.end(), page.begin(), page.end());
+        }
+        ASSERT_EQ(data, concatenated) << "Mismatch on chip " << chip;
+    }
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, BarRegisterBatchWrites) {
+    // Write, modify and read back L1 words through the BAR window of a static TLB in one batch.
+    uint32_t num_host_mem_ch_per_mmio_device = 1;
+    Cluster device = Cluster(num_host_mem_ch_per_mmio_device, false, true, true);
+
+    const chip_id_t mmio_chip = *device.get_target_mmio_device_ids().begin();
+    const tt_xy_pair core = device.get_virtual_soc_descriptors().at(mmio_chip).workers.at(0);
+    const uint32_t address = l1_mem::address_map::NCRISC_FIRMWARE_BASE;
+    device.configure_tlb(mmio_chip, core, get_static_tlb_index(core), address);
+    device.setup_core_to_tlb_map(mmio_chip, [](tt_xy_pair target) { return get_static_tlb_index(target); });
+
+    tt_device_params default_params;
+    device.start_device(default_params);
+
+    auto tlb_data = device.get_tlb_data_from_target(tt_cxy_pair(mmio_chip, core));
+    ASSERT_TRUE(tlb_data.has_value());
+    const uint32_t window = std::get<0>(tlb_data.value());
+
+    std::vector<uint32_t> values = device.bar_batch32(
+        mmio_chip,
+        {reg_batch_op::write(window, 0x11111111),
+         reg_batch_op::write(window + 4, 0x22222222),
+         reg_batch_op::write(window + 8, 0x33333333),
+         reg_batch_op::modify(window + 4, 0xabcd0000, 0xffff0000),
+         reg_batch_op::read(window),
+         reg_batch_op::read(window + 4),
+         reg_batch_op::read(window + 8)});
+    EXPECT_EQ(values, std::vector<uint32_t>({0x11111111, 0xabcd2222, 0x33333333}));
+
+    std::vector<uint32_t> readback(3);
+    device.read_from_device(
+        readback.data(), tt_cxy_pair(mmio_chip, core), address, readback.size() * sizeof(uint32_t), "LARGE_READ_TLB");
+    EXPECT_EQ(readback, values);
+    device.close_device();
+}
+
+TEST(SiliconDriverWH, RegisteredHostMemoryWithPcie) {
+    // The device reads and writes a registered buffer through the PCIe core, at the address the registration returns.
+    Cluster cluster(1, false, true, true);
+    set_params_for_remote_txn(cluster);
+    cluster.start_device(tt_device_params{});
+
+    const chip_id_t mmio_chip_id = 0;
+    const auto PCIE = cluster.get_soc_descriptor(mmio_chip_id).pcie_cores.at(0);
+    const tt_cxy_pair PCIE_CORE(mmio_chip_id, PCIE.x, PCIE.y);
+    const size_t test_size_bytes = 0x4000;
+    // Registrations cover the whole iATU region of their window, which is at least 256MB in every window.
+    const size_t registered_size_bytes = 256 << 20;
+
+    // Page aligned, so that the registration pins only the buffer's own pages.
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    std::unique_ptr<uint8_t, decltype(&std::free)> host_buffer(
+        static_cast<uint8_t*>(std::aligned_alloc(page_size, registered_size_bytes)), &std::free);
+    test_utils::fill_with_random_bytes(host_buffer.get(), test_size_bytes);
+
+    uint64_t device_address = 0;
+    try {
+        device_address = cluster.register_host_memory(mmio_chip_id, host_buffer.get(), registered_size_bytes);
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "Host memory can't be pinned without an IOMMU: " << e.what();
+    }
+    // A buffer inside of the registration reuses it, a buffer smaller than an iATU region can't be registered.
+    EXPECT_EQ(cluster.register_host_memory(mmio_chip_id, host_buffer.get(), test_size_bytes), device_address);
+    cluster.release_host_memory(mmio_chip_id, host_buffer.get());
+    std::unique_ptr<uint8_t, decltype(&std::free)> small_buffer(
+        static_cast<uint8_t*>(std::aligned_alloc(page_size, test_size_bytes)), &std::free);
+    EXPECT_THROW(cluster.register_host_memory(mmio_chip_id, small_buffer.get(), test_size_bytes), std::runtime_error);
+    const uint64_t noc_address = cluster.get_pcie_base_addr_from_device(mmio_chip_id) + device_address;
+
+    std::vector<uint8_t> buffer(test_size_bytes, 0x0);
+    cluster.read_from_device(buffer.data(), PCIE_CORE, noc_address, buffer.size(), "REG_TLB");
+    ASSERT_EQ(buffer, std::vector<uint8_t>(host_buffer.get(), host_buffer.get() + test_size_bytes));
+
+    test_utils::fill_with_random_bytes(buffer.data(), test_size_bytes);
+    cluster.write_to_device(buffer.data(), buffer.size(), PCIE_CORE, noc_address, "REG_TLB");
+    // Read back to make sure the write has landed.
+    std::vector<uint8_t> throwaway(test_size_bytes, 0x0);
+    cluster.read_from_device(throwaway.data(), PCIE_CORE, noc_address, throwaway.size(), "REG_TLB");
+    ASSERT_EQ(buffer, std::vector<uint8_t>(host_buffer.get(), host_buffer.get() + test_size_bytes));
+
+    cluster.release_host_memory(mmio_chip_id, host_buffer.get());
+    cluster.unregister_host_memory(mmio_chip_id, host_buffer.get(), registered_size_bytes);
+    cluster.close_device();
+}
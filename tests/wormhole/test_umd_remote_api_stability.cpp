@@ -419,4 +419,21 @@ TEST_F(WormholeNebulaX2TestFixture, MultithreadedMixedRemoteTransfersLargeWrites
     read_cmd_threads1.join();
     read_cmd_threads2.join();
 }
+
+TEST_F(WormholeNebulaX2TestFixture, ZeroCopyRemoteRead) {
+    const chip_id_t remote_chip = *device->get_target_remote_device_ids().begin();
+    const tt_xy_pair core = device->get_soc_descriptor(remote_chip).workers.at(0);
+    const uint64_t address = 0x100000;
+
+    for (uint32_t size : {4, 64, 3000, 100 * 1024}) {
+        std::vector<uint32_t> written_data(size / sizeof(uint32_t));
+        std::iota(written_data.begin(), written_data.end(), size);
+        device->write_to_device(written_data.data(), size, tt_cxy_pair(remote_chip, core), address, "LARGE_WRITE_TLB");
+        device->wait_for_non_mmio_flush(remote_chip);
+
+        const uint32_t* read_data = static_cast<uint32_t*>(
+            device->read_from_remote_device_to_sysmem(tt_cxy_pair(remote_chip, core), address, size, 0));
+        EXPECT_EQ(written_data, std::vector<uint32_t>(read_data, read_data + size / sizeof(uint32_t)));
+    }
+}
 }  // namespace tt::umd::test::utils